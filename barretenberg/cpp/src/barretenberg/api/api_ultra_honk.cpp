@@ -106,8 +106,7 @@ bool _verify(const bool ipa_accumulation,
     using VerificationKey = typename Flavor::VerificationKey;
     using Verifier = UltraVerifier_<Flavor>;
 
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    init_bn254_verifier_crs();
 
     auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
     vk->pcs_verification_key = std::make_shared<VerifierCommitmentKey<curve::BN254>>();
@@ -17,8 +17,7 @@ extern std::string CRS_PATH;
 acir_proofs::AcirComposer verifier_init()
 {
     acir_proofs::AcirComposer acir_composer(0, verbose_logging);
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    init_bn254_verifier_crs();
     return acir_composer;
 }
 
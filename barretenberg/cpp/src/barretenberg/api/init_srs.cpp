@@ -2,10 +2,23 @@
 #include "barretenberg/srs/global_crs.hpp"
 #include "get_bn254_crs.hpp"
 #include "get_grumpkin_crs.hpp"
+#include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
+#include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include <mutex>
 
 namespace bb {
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 
+namespace {
+// The largest CRS loaded so far by this process. Commands that need at most as many points reuse it instead of reading
+// the points from disk again, which matters when many commands run in one process (see bb server).
+std::mutex loaded_crs_mutex;
+std::shared_ptr<srs::factories::CrsFactory<curve::BN254>> loaded_bn254_crs;
+size_t loaded_bn254_crs_size = 0;
+std::shared_ptr<srs::factories::CrsFactory<curve::Grumpkin>> loaded_grumpkin_crs;
+size_t loaded_grumpkin_crs_size = 0;
+} // namespace
+
 std::string getHomeDir()
 {
     char* home = std::getenv("HOME");
@@ -20,9 +33,27 @@ std::string getHomeDir()
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
-    auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    const size_t num_points = dyadic_circuit_size + 1;
+    std::lock_guard lock(loaded_crs_mutex);
+    if (loaded_bn254_crs == nullptr || loaded_bn254_crs_size < num_points) {
+        auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, num_points);
+        auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
+        loaded_bn254_crs = std::make_shared<srs::factories::MemBn254CrsFactory>(bn254_g1_data, bn254_g2_data);
+        loaded_bn254_crs_size = num_points;
+    }
+    srs::init_crs_factory(loaded_bn254_crs);
+}
+
+void init_bn254_verifier_crs()
+{
+    std::lock_guard lock(loaded_crs_mutex);
+    if (loaded_bn254_crs == nullptr) {
+        // A G2-only crs. The next init_bn254_crs replaces it, since it holds no G1 points.
+        loaded_bn254_crs = std::make_shared<srs::factories::MemBn254CrsFactory>(std::vector<g1::affine_element>{},
+                                                                                get_bn254_g2_data(CRS_PATH));
+        loaded_bn254_crs_size = 0;
+    }
+    srs::init_crs_factory(loaded_bn254_crs);
 }
 
 /**
@@ -33,7 +64,13 @@ void init_bn254_crs(size_t dyadic_circuit_size)
  */
 void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 {
-    auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, eccvm_dyadic_circuit_size + 1);
-    srs::init_grumpkin_crs_factory(grumpkin_g1_data);
+    const size_t num_points = eccvm_dyadic_circuit_size + 1;
+    std::lock_guard lock(loaded_crs_mutex);
+    if (loaded_grumpkin_crs == nullptr || loaded_grumpkin_crs_size < num_points) {
+        auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, num_points);
+        loaded_grumpkin_crs = std::make_shared<srs::factories::MemGrumpkinCrsFactory>(grumpkin_g1_data);
+        loaded_grumpkin_crs_size = num_points;
+    }
+    srs::init_grumpkin_crs_factory(loaded_grumpkin_crs);
 }
 } // namespace bb
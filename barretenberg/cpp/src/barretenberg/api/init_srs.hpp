@@ -12,6 +12,13 @@ std::string getHomeDir();
  */
 void init_bn254_crs(size_t dyadic_circuit_size);
 
+/**
+ * @brief Make sure the global crs_factory for bn254 can serve a verifier crs
+ * @details Only reads the G2 point if no bn254 crs was loaded before. An already loaded crs is kept, so that commands
+ * that are proving concurrently (see bb server) never see their prover crs disappear.
+ */
+void init_bn254_verifier_crs();
+
 /**
  * @brief Initialize the global crs_factory for grumpkin based on a known dyadic circuit size
  * @details Grumpkin crs is required only for the ECCVM
@@ -21,6 +21,7 @@
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/prove_tube.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
+#include "barretenberg/bb/server.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_rollup_flavor.hpp"
@@ -92,9 +93,11 @@ void print_subcommand_options(const CLI::App* sub)
  *
  * @param argc Number of command-line arguments
  * @param argv Array of command-line argument strings
+ * @param configure_logging Whether to set the global logging flags from the arguments. The server runs commands
+ * concurrently, so it sets them once at start-up instead.
  * @return int Status code: 0 for success, non-zero for errors or verification failure
  */
-int parse_and_run_cli_command(int argc, char* argv[])
+int parse_and_run_cli_command(int argc, char* argv[], bool configure_logging)
 {
     std::string name = "Barretenberg\nYour favo(u)rite zkSNARK library written in C++, a perfectly good computer "
                        "programming language.";
@@ -684,13 +687,34 @@ int parse_and_run_cli_command(int argc, char* argv[])
     std::string tube_proof_and_vk_path{ "./target" };
     add_output_path_option(verify_tube_command, tube_proof_and_vk_path);
 
+    /***************************************************************************************************************
+     * Subcommand: server
+     ***************************************************************************************************************/
+    CLI::App* server_command =
+        app.add_subcommand("server",
+                           "Run as a long-lived process that executes bb commands sent as length-prefixed msgpack "
+                           "requests, over stdin/stdout or a unix socket. The CRS, lookup tables and thread pool are "
+                           "kept warm between commands, and commands run concurrently within a memory budget.");
+    add_verbose_flag(server_command);
+    add_debug_flag(server_command);
+    add_crs_path_option(server_command);
+    server::ServerOptions server_options;
+    server_command->add_option(
+        "--socket", server_options.socket_path, "Listen on this unix socket instead of reading from stdin.");
+    server_command->add_option("--memory_budget_mb",
+                               server_options.memory_budget_mb,
+                               "Memory that concurrently running commands may use, according to the estimates sent "
+                               "with their requests. Defaults to the physical memory of the machine.");
+
     /***************************************************************************************************************
      * Build the CLI11 App
      ***************************************************************************************************************/
 
     CLI11_PARSE(app, argc, argv);
-    debug_logging = flags.debug;
-    verbose_logging = debug_logging || flags.verbose;
+    if (configure_logging) {
+        debug_logging = flags.debug;
+        verbose_logging = debug_logging || flags.verbose;
+    }
 
     print_active_subcommands(app);
     info("Scheme is: ", flags.scheme, ", num threads: ", get_num_cpus());
@@ -732,6 +756,18 @@ int parse_and_run_cli_command(int argc, char* argv[])
     };
 
     try {
+        if (server_command->parsed()) {
+            return server::run_server(server_options, [](const std::vector<std::string>& args) {
+                std::vector<std::string> command = { "bb" };
+                command.insert(command.end(), args.begin(), args.end());
+                std::vector<char*> command_argv;
+                for (auto& arg : command) {
+                    command_argv.push_back(arg.data());
+                }
+                return parse_and_run_cli_command(
+                    static_cast<int>(command_argv.size()), command_argv.data(), /*configure_logging=*/false);
+            });
+        }
         // ULTRA PLONK
         if (OLD_API_gates->parsed()) {
             gate_count<UltraCircuitBuilder>(bytecode_path, flags.recursive, flags.honk_recursion, true);
@@ -1,5 +1,5 @@
 #pragma once
 
 namespace bb {
-int parse_and_run_cli_command(int argc, char* argv[]);
+int parse_and_run_cli_command(int argc, char* argv[], bool configure_logging = true);
 }
@@ -0,0 +1,322 @@
+#include "barretenberg/bb/server.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/messaging/stream_parser.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+namespace bb::server {
+
+namespace {
+
+// Returns false if the stream ended before size bytes were read.
+bool read_exact(int fd, char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t n = ::read(fd, data, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool write_all(int fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t n = ::write(fd, data, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// The output stream of a connection. Responses of concurrently running commands are written whole, one at a time.
+class FrameWriter {
+  public:
+    explicit FrameWriter(int fd)
+        : fd(fd)
+    {}
+
+    template <typename T> void send(T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        std::lock_guard lock(mutex);
+        // If the peer went away there is nobody left to tell, the command still ran to completion.
+        write_frame(fd, buffer.data(), buffer.size());
+    }
+
+  private:
+    int fd;
+    std::mutex mutex;
+};
+
+// Detached threads that can be waited for as a group. Unlike a vector of joinable threads, finished threads do not
+// pile up over the lifetime of the server.
+class ThreadGroup {
+  public:
+    ThreadGroup() = default;
+    ThreadGroup(const ThreadGroup&) = delete;
+    ThreadGroup& operator=(const ThreadGroup&) = delete;
+    ~ThreadGroup() { wait(); }
+
+    template <typename Func> void spawn(Func&& func)
+    {
+        {
+            std::lock_guard lock(mutex);
+            active++;
+        }
+        std::thread([this, func = std::forward<Func>(func)]() mutable {
+            func();
+            std::lock_guard lock(mutex);
+            if (--active == 0) {
+                idle.notify_all();
+            }
+        }).detach();
+    }
+
+    void wait()
+    {
+        std::unique_lock lock(mutex);
+        idle.wait(lock, [&] { return active == 0; });
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable idle;
+    size_t active = 0;
+};
+
+// Serves the requests of one client until it disconnects or asks us to terminate.
+class Session {
+  public:
+    Session(int in_fd, int out_fd, MemoryAdmission& admission, const CommandRunner& run_command)
+        : in_fd(in_fd)
+        , writer(out_fd)
+        , admission(admission)
+        , run_command(run_command)
+    {}
+
+    // Returns false if the client sent TERMINATE.
+    bool serve()
+    {
+        messaging::StreamDispatcher<FrameWriter> dispatcher(writer);
+        std::function<bool(msgpack::object&)> run_command_handler = [this](msgpack::object& obj) {
+            messaging::TypedMessage<RunCommandRequest> request;
+            obj.convert(request);
+            workers.spawn([this, request = std::move(request)]() { handle(request); });
+            return true;
+        };
+        dispatcher.registerTarget(RUN_COMMAND, run_command_handler);
+
+        bool keep_running = true;
+        std::vector<char> frame;
+        while (keep_running && read_frame(in_fd, frame)) {
+            try {
+                msgpack::object_handle handle = msgpack::unpack(frame.data(), frame.size());
+                msgpack::object obj = handle.get();
+                keep_running = dispatcher.onNewData(obj);
+            } catch (const std::exception& e) {
+                info("bb server: dropping malformed message: ", e.what());
+            }
+        }
+        workers.wait();
+        return keep_running;
+    }
+
+  private:
+    void handle(const messaging::TypedMessage<RunCommandRequest>& request)
+    {
+        RunCommandResponse response;
+        const uint64_t admitted_mb = admission.acquire(request.value.memory_estimate_mb);
+        try {
+            if (request.value.args.empty() || request.value.args[0] == "server") {
+                throw std::runtime_error("expected the arguments of a bb command other than server");
+            }
+            response.exit_code = run_command(request.value.args);
+        } catch (const std::exception& e) {
+            response.exit_code = 1;
+            response.error = e.what();
+        }
+        admission.release(admitted_mb);
+
+        messaging::MsgHeader header(next_message_id++, request.header.messageId);
+        messaging::TypedMessage<RunCommandResponse> message(RUN_COMMAND, header, response);
+        writer.send(message);
+    }
+
+    int in_fd;
+    FrameWriter writer;
+    MemoryAdmission& admission;
+    const CommandRunner& run_command;
+    std::atomic<uint32_t> next_message_id = 0;
+    // Declared last, so that it is destroyed (waits for the workers) before anything the workers use.
+    ThreadGroup workers;
+};
+
+uint64_t physical_memory_mb()
+{
+    const long pages = sysconf(_SC_PHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGE_SIZE);
+    if (pages <= 0 || page_size <= 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(pages) * static_cast<uint64_t>(page_size) / (1024 * 1024);
+}
+
+int serve_stdio(MemoryAdmission& admission, const CommandRunner& run_command)
+{
+    // Commands may print to stdout (e.g. when writing to "-"), which would corrupt the response stream. Keep the
+    // original stdout for responses and send everything else to stderr.
+    const int out_fd = dup(STDOUT_FILENO);
+    if (out_fd < 0 || dup2(STDERR_FILENO, STDOUT_FILENO) < 0) {
+        info("bb server: could not redirect stdout: ", std::strerror(errno));
+        return 1;
+    }
+    serve_connection(STDIN_FILENO, out_fd, admission, run_command);
+    close(out_fd);
+    return 0;
+}
+
+int serve_socket(const std::string& socket_path, MemoryAdmission& admission, const CommandRunner& run_command)
+{
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        info("bb server: socket path is too long: ", socket_path);
+        return 1;
+    }
+    std::copy(socket_path.begin(), socket_path.end(), addr.sun_path);
+
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        info("bb server: could not create socket: ", std::strerror(errno));
+        return 1;
+    }
+    // A socket file left behind by a previous server would make bind fail.
+    unlink(socket_path.c_str());
+    if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(listen_fd, SOMAXCONN) < 0) {
+        info("bb server: could not listen on ", socket_path, ": ", std::strerror(errno));
+        close(listen_fd);
+        return 1;
+    }
+    info("bb server: listening on ", socket_path);
+
+    std::atomic<bool> terminated = false;
+    {
+        ThreadGroup sessions;
+        while (!terminated) {
+            const int conn_fd = accept(listen_fd, nullptr, nullptr);
+            if (conn_fd < 0) {
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                // Also how a TERMINATE from another connection wakes us up, see below.
+                break;
+            }
+            sessions.spawn([&, conn_fd]() {
+                if (!serve_connection(conn_fd, conn_fd, admission, run_command)) {
+                    terminated = true;
+                    shutdown(listen_fd, SHUT_RDWR);
+                }
+                close(conn_fd);
+            });
+        }
+    }
+    close(listen_fd);
+    unlink(socket_path.c_str());
+    return 0;
+}
+
+} // namespace
+
+bool read_frame(int fd, std::vector<char>& frame)
+{
+    std::array<uint8_t, 4> length_bytes{};
+    if (!read_exact(fd, reinterpret_cast<char*>(length_bytes.data()), length_bytes.size())) {
+        return false;
+    }
+    const uint32_t length = static_cast<uint32_t>(length_bytes[0]) | (static_cast<uint32_t>(length_bytes[1]) << 8) |
+                            (static_cast<uint32_t>(length_bytes[2]) << 16) |
+                            (static_cast<uint32_t>(length_bytes[3]) << 24);
+    if (length > MAX_FRAME_SIZE) {
+        info("bb server: frame of ", length, " bytes exceeds the limit, closing the connection");
+        return false;
+    }
+    frame.resize(length);
+    return read_exact(fd, frame.data(), length);
+}
+
+bool write_frame(int fd, const char* data, size_t size)
+{
+    const auto length = static_cast<uint32_t>(size);
+    const std::array<char, 4> length_bytes{ static_cast<char>(length & 0xff),
+                                            static_cast<char>((length >> 8) & 0xff),
+                                            static_cast<char>((length >> 16) & 0xff),
+                                            static_cast<char>((length >> 24) & 0xff) };
+    return write_all(fd, length_bytes.data(), length_bytes.size()) && write_all(fd, data, size);
+}
+
+bool serve_connection(int in_fd, int out_fd, MemoryAdmission& admission, const CommandRunner& run_command)
+{
+    Session session(in_fd, out_fd, admission, run_command);
+    return session.serve();
+}
+
+MemoryAdmission::MemoryAdmission(uint64_t budget_mb)
+    : budget_mb(std::max<uint64_t>(budget_mb, 1))
+{}
+
+uint64_t MemoryAdmission::acquire(uint64_t memory_mb)
+{
+    const uint64_t admitted_mb = memory_mb == 0 ? budget_mb : std::min(memory_mb, budget_mb);
+    std::unique_lock lock(mutex);
+    released.wait(lock, [&] { return in_use_mb + admitted_mb <= budget_mb; });
+    in_use_mb += admitted_mb;
+    return admitted_mb;
+}
+
+void MemoryAdmission::release(uint64_t admitted_mb)
+{
+    {
+        std::lock_guard lock(mutex);
+        in_use_mb -= admitted_mb;
+    }
+    released.notify_all();
+}
+
+int run_server(const ServerOptions& options, const CommandRunner& run_command)
+{
+    // Writing to a client that disconnected must not take the server down.
+    std::signal(SIGPIPE, SIG_IGN);
+
+    const uint64_t budget_mb = options.memory_budget_mb != 0 ? options.memory_budget_mb : physical_memory_mb();
+    info("bb server: memory budget ", budget_mb, "MB");
+    MemoryAdmission admission(budget_mb);
+    if (options.socket_path.empty()) {
+        return serve_stdio(admission, run_command);
+    }
+    return serve_socket(options.socket_path, admission, run_command);
+}
+
+} // namespace bb::server
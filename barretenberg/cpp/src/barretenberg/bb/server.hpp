@@ -0,0 +1,89 @@
+#pragma once
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace bb::server {
+
+/**
+ * Wire protocol of `bb server`.
+ *
+ * Every message is a little endian uint32 byte length followed by that many bytes of msgpack. Requests are
+ * TypedMessage<RunCommandRequest> with msgType RUN_COMMAND, answered by a TypedMessage<RunCommandResponse> whose
+ * header.requestId is the messageId of the request. The system messages of messaging/header.hpp are supported too:
+ * PING is answered with PONG and TERMINATE shuts the server down once the running commands are done.
+ */
+enum MsgTypes : uint32_t { RUN_COMMAND = messaging::FIRST_APP_MSG_TYPE };
+
+// Anything larger is not a request we would want to parse, most likely the peer does not speak our protocol.
+constexpr uint32_t MAX_FRAME_SIZE = 1 << 24;
+
+// Reads one frame into frame. Returns false if the stream ended or the frame is larger than MAX_FRAME_SIZE.
+bool read_frame(int fd, std::vector<char>& frame);
+// Writes size bytes of data as one frame. Returns false if the stream was closed.
+bool write_frame(int fd, const char* data, size_t size);
+
+struct RunCommandRequest {
+    // The arguments of a bb invocation, without the program name, e.g. { "prove", "--scheme", "ultra_honk", ... }
+    // Logging flags are ignored, logging is configured once by the flags of `bb server`.
+    std::vector<std::string> args;
+    // Peak memory the command is expected to need. Commands that leave this at 0 run on their own.
+    uint64_t memory_estimate_mb = 0;
+
+    MSGPACK_FIELDS(args, memory_estimate_mb);
+};
+
+struct RunCommandResponse {
+    int32_t exit_code = 0;
+    std::string error;
+
+    MSGPACK_FIELDS(exit_code, error);
+};
+
+/**
+ * @brief Admission control on the memory that concurrently running commands are expected to use.
+ */
+class MemoryAdmission {
+  public:
+    explicit MemoryAdmission(uint64_t budget_mb);
+
+    // Blocks until the request fits into what is left of the budget. Requests larger than the whole budget (or
+    // without an estimate) wait until nothing else runs.
+    uint64_t acquire(uint64_t memory_mb);
+    void release(uint64_t admitted_mb);
+
+  private:
+    const uint64_t budget_mb;
+    uint64_t in_use_mb = 0;
+    std::mutex mutex;
+    std::condition_variable released;
+};
+
+struct ServerOptions {
+    // Listen on this unix domain socket. If empty, requests are read from stdin and responses written to stdout.
+    std::string socket_path;
+    uint64_t memory_budget_mb = 0;
+};
+
+using CommandRunner = std::function<int(const std::vector<std::string>& args)>;
+
+/**
+ * @brief Serves the requests read from in_fd until TERMINATE is received or in_fd is closed, writing the responses to
+ * out_fd. Returns false if the client sent TERMINATE.
+ */
+bool serve_connection(int in_fd, int out_fd, MemoryAdmission& admission, const CommandRunner& run_command);
+
+/**
+ * @brief Serves RUN_COMMAND requests until TERMINATE is received (or stdin is closed), running each request on its own
+ * thread. Everything that is global to the process (the CRS, plookup tables, the thread pool) stays warm between
+ * requests.
+ */
+int run_server(const ServerOptions& options, const CommandRunner& run_command);
+
+} // namespace bb::server
@@ -0,0 +1,215 @@
+#include "barretenberg/bb/server.hpp"
+#include "barretenberg/serialize/cbind.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace bb;
+using namespace bb::server;
+
+namespace {
+
+// Both ends of a pipe, closed on destruction.
+struct Pipe {
+    std::array<int, 2> fds{ -1, -1 };
+
+    Pipe() { EXPECT_EQ(pipe(fds.data()), 0); }
+    ~Pipe()
+    {
+        close_write();
+        close(fds[0]);
+    }
+    int read_fd() const { return fds[0]; }
+    int write_fd() const { return fds[1]; }
+    void close_write()
+    {
+        if (fds[1] >= 0) {
+            close(fds[1]);
+            fds[1] = -1;
+        }
+    }
+};
+
+template <typename T> void send_message(int fd, T& message)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, message);
+    ASSERT_TRUE(write_frame(fd, buffer.data(), buffer.size()));
+}
+
+void send_run_command(int fd, uint32_t message_id, std::vector<std::string> args)
+{
+    messaging::MsgHeader header(message_id, 0);
+    messaging::TypedMessage<RunCommandRequest> request(RUN_COMMAND, header, RunCommandRequest{ std::move(args), 0 });
+    send_message(fd, request);
+}
+
+void send_system_message(int fd, uint32_t msg_type, uint32_t message_id)
+{
+    messaging::MsgHeader header(message_id, 0);
+    messaging::HeaderOnlyMessage message(msg_type, header);
+    send_message(fd, message);
+}
+
+msgpack::object_handle receive_message(int fd)
+{
+    std::vector<char> frame;
+    EXPECT_TRUE(read_frame(fd, frame));
+    return msgpack::unpack(frame.data(), frame.size());
+}
+
+} // namespace
+
+TEST(ServerTest, FramesRoundTrip)
+{
+    Pipe pipe;
+    const std::string payload = "payload";
+    ASSERT_TRUE(write_frame(pipe.write_fd(), payload.data(), payload.size()));
+    ASSERT_TRUE(write_frame(pipe.write_fd(), nullptr, 0));
+
+    std::vector<char> frame;
+    ASSERT_TRUE(read_frame(pipe.read_fd(), frame));
+    EXPECT_EQ(std::string(frame.begin(), frame.end()), payload);
+    ASSERT_TRUE(read_frame(pipe.read_fd(), frame));
+    EXPECT_TRUE(frame.empty());
+
+    // The stream ends in the middle of a frame.
+    const std::array<char, 6> truncated{ 8, 0, 0, 0, 'a', 'b' };
+    ASSERT_EQ(write(pipe.write_fd(), truncated.data(), truncated.size()), truncated.size());
+    pipe.close_write();
+    EXPECT_FALSE(read_frame(pipe.read_fd(), frame));
+}
+
+TEST(ServerTest, RejectsOversizedFrames)
+{
+    Pipe pipe;
+    const uint32_t length = MAX_FRAME_SIZE + 1;
+    const std::array<char, 4> length_bytes{ static_cast<char>(length & 0xff),
+                                            static_cast<char>((length >> 8) & 0xff),
+                                            static_cast<char>((length >> 16) & 0xff),
+                                            static_cast<char>((length >> 24) & 0xff) };
+    ASSERT_EQ(write(pipe.write_fd(), length_bytes.data(), length_bytes.size()), length_bytes.size());
+
+    std::vector<char> frame;
+    EXPECT_FALSE(read_frame(pipe.read_fd(), frame));
+}
+
+TEST(ServerTest, ServesRequestsUntilTerminate)
+{
+    Pipe requests;
+    Pipe responses;
+    MemoryAdmission admission(1024);
+    std::mutex commands_mutex;
+    std::vector<std::vector<std::string>> commands;
+    CommandRunner run_command = [&](const std::vector<std::string>& args) {
+        {
+            std::lock_guard lock(commands_mutex);
+            commands.push_back(args);
+        }
+        if (args[0] == "fail") {
+            throw std::runtime_error("failed");
+        }
+        return 3;
+    };
+
+    send_run_command(requests.write_fd(), 7, { "prove", "--scheme", "ultra_honk" });
+    send_system_message(requests.write_fd(), messaging::PING, 8);
+    send_run_command(requests.write_fd(), 9, { "server" });
+    send_run_command(requests.write_fd(), 10, { "fail" });
+    send_system_message(requests.write_fd(), messaging::TERMINATE, 11);
+    EXPECT_FALSE(serve_connection(requests.read_fd(), responses.write_fd(), admission, run_command));
+
+    // Commands run on their own threads, in any order. The server command is rejected before it runs.
+    std::sort(commands.begin(), commands.end());
+    ASSERT_EQ(commands.size(), 2);
+    EXPECT_EQ(commands[0], (std::vector<std::string>{ "fail" }));
+    EXPECT_EQ(commands[1], (std::vector<std::string>{ "prove", "--scheme", "ultra_honk" }));
+
+    // Responses of commands may arrive in any order, the PONG is sent by the reading thread.
+    int32_t prove_exit_code = -1;
+    std::string server_error;
+    std::string fail_error;
+    bool ponged = false;
+    for (size_t i = 0; i < 4; i++) {
+        auto handle = receive_message(responses.read_fd());
+        messaging::HeaderOnlyMessage header;
+        handle.get().convert(header);
+        if (header.msgType == messaging::PONG) {
+            EXPECT_EQ(header.header.requestId, 8);
+            ponged = true;
+            continue;
+        }
+        ASSERT_EQ(header.msgType, RUN_COMMAND);
+        messaging::TypedMessage<RunCommandResponse> message;
+        handle.get().convert(message);
+        if (message.header.requestId == 7) {
+            prove_exit_code = message.value.exit_code;
+        } else if (message.header.requestId == 9) {
+            EXPECT_EQ(message.value.exit_code, 1);
+            server_error = message.value.error;
+        } else {
+            EXPECT_EQ(message.header.requestId, 10);
+            EXPECT_EQ(message.value.exit_code, 1);
+            fail_error = message.value.error;
+        }
+    }
+    EXPECT_TRUE(ponged);
+    EXPECT_EQ(prove_exit_code, 3);
+    EXPECT_FALSE(server_error.empty());
+    EXPECT_EQ(fail_error, "failed");
+}
+
+TEST(ServerTest, ClosedInputEndsSession)
+{
+    Pipe requests;
+    Pipe responses;
+    MemoryAdmission admission(1024);
+    CommandRunner run_command = [](const std::vector<std::string>&) { return 0; };
+
+    requests.close_write();
+    EXPECT_TRUE(serve_connection(requests.read_fd(), responses.write_fd(), admission, run_command));
+}
+
+TEST(MemoryAdmissionTest, AdmitsWithinBudget)
+{
+    MemoryAdmission admission(100);
+    EXPECT_EQ(admission.acquire(60), 60);
+    EXPECT_EQ(admission.acquire(40), 40);
+    admission.release(60);
+    admission.release(40);
+
+    // Requests without an estimate, or larger than the budget, take the whole budget.
+    EXPECT_EQ(admission.acquire(0), 100);
+    admission.release(100);
+    EXPECT_EQ(admission.acquire(1000), 100);
+    admission.release(100);
+}
+
+TEST(MemoryAdmissionTest, WaitsForRelease)
+{
+    MemoryAdmission admission(100);
+    const uint64_t first = admission.acquire(70);
+
+    std::atomic<bool> admitted = false;
+    std::thread waiter([&]() {
+        admission.release(admission.acquire(50));
+        admitted = true;
+    });
+    // Not a proof that the waiter blocks, but it would almost certainly be admitted by now if it did not.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(admitted);
+
+    admission.release(first);
+    waiter.join();
+    EXPECT_TRUE(admitted);
+}
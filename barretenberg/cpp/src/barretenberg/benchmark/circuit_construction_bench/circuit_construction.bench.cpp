@@ -4,6 +4,7 @@
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -40,7 +41,32 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+/**
+ * @brief Construction of the proving key of a 2^k gate circuit in which every wire is copy constrained, which makes the
+ * computation of the sigma/id polynomials a large part of the work
+ */
+void proving_key_construction_bench(State& state)
+{
+    const size_t num_gates = 1UL << static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        UltraCircuitBuilder builder;
+        // A Fibonacci-like chain: the output of every gate is an input of the next two gates
+        uint32_t a_idx = builder.add_variable(fr::random_element());
+        uint32_t b_idx = builder.add_variable(fr::random_element());
+        for (size_t i = 0; i < num_gates; ++i) {
+            uint32_t c_idx = builder.add_variable(builder.get_variable(a_idx) + builder.get_variable(b_idx));
+            builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+            a_idx = b_idx;
+            b_idx = c_idx;
+        }
+        state.ResumeTiming();
+        DeciderProvingKey_<UltraFlavor> proving_key(builder);
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(proving_key_construction_bench)->Unit(kMillisecond)->DenseRange(16, 20, 2);
 
 BENCHMARK_MAIN();
@@ -66,6 +66,21 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+// Verifies the proofs of all sizes produced by ipa_open in one batch
+void ipa_batch_verify(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (const auto& prover_transcript : prover_transcripts) {
+            verifier_transcripts.push_back(std::make_shared<NativeTranscript>(prover_transcript->proof_data));
+        }
+
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_reduce_verify(vk, opening_claims, verifier_transcripts);
+        ASSERT(result);
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +90,5 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_batch_verify)->Unit(kMillisecond)->Setup(DoSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
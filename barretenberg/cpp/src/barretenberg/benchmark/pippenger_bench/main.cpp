@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batch_affine_pippenger.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -42,7 +43,12 @@ using namespace bb;
 //     return acc;
 // }
 constexpr size_t NUM_POINTS = 1 << 16;
+// MSM sizes compared between the pippenger backends
+constexpr size_t MIN_LOG_MSM_POINTS = 16;
+constexpr size_t MAX_LOG_MSM_POINTS = 22;
+constexpr size_t MAX_MSM_POINTS = 1UL << MAX_LOG_MSM_POINTS;
 std::vector<fr> scalars;
+std::vector<fr> msm_scalars;
 static bb::evaluation_domain small_domain;
 static bb::evaluation_domain large_domain;
 
@@ -58,6 +64,11 @@ const auto init = []() {
         scalars.emplace_back(accumulator);
     }
 
+    msm_scalars.resize(MAX_MSM_POINTS);
+    for (auto& scalar : msm_scalars) {
+        scalar = fr::random_element();
+    }
+
     // monomials =
 
     return 1;
@@ -65,7 +76,7 @@ const auto init = []() {
 // constexpr double add_to_mixed_add_complexity = 1.36;
 
 auto reference_string =
-    std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(NUM_POINTS, bb::srs::get_ignition_crs_path());
+    std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(MAX_MSM_POINTS, bb::srs::get_ignition_crs_path());
 
 int pippenger()
 {
@@ -82,6 +93,34 @@ int pippenger()
     return 0;
 }
 
+/**
+ * @brief Compare pippenger_unsafe against the signed-digit batch-affine backend for 2^16 to 2^22 points
+ */
+int pippenger_backends()
+{
+    const PolynomialSpan<const fr> all_scalars{ /*start_index*/ 0, msm_scalars };
+    for (size_t log_num_points = MIN_LOG_MSM_POINTS; log_num_points <= MAX_LOG_MSM_POINTS; ++log_num_points) {
+        const size_t num_points = 1UL << log_num_points;
+        const PolynomialSpan<const fr> msm_span{ /*start_index*/ 0, all_scalars.span.subspan(0, num_points) };
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_points);
+
+        std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+        g1::element unsafe_result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            msm_span, reference_string->get_monomial_points(), state);
+        std::chrono::steady_clock::time_point time_mid = std::chrono::steady_clock::now();
+        g1::element batch_affine_result = scalar_multiplication::pippenger_batch_affine<curve::BN254>(
+            msm_span, reference_string->get_monomial_points());
+        std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+
+        ASSERT(unsafe_result == batch_affine_result);
+        const auto unsafe_time = std::chrono::duration_cast<std::chrono::microseconds>(time_mid - time_start);
+        const auto batch_affine_time = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_mid);
+        std::cout << "2^" << log_num_points << " points: pippenger_unsafe " << unsafe_time.count()
+                  << "us, pippenger_batch_affine " << batch_affine_time.count() << "us" << std::endl;
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -117,5 +156,7 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "comparing pippenger backends" << std::endl;
+    pippenger_backends();
     return 0;
 }
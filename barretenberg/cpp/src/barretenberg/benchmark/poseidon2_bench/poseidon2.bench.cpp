@@ -1,4 +1,5 @@
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <benchmark/benchmark.h>
 
@@ -41,4 +42,83 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+using Poseidon2Permutation = bb::crypto::Poseidon2Permutation<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+void poseidon2_hash2_bench(State& state) noexcept
+{
+    grumpkin::fq x = grumpkin::fq::random_element();
+    grumpkin::fq y = grumpkin::fq::random_element();
+    for (auto _ : state) {
+        DoNotOptimize(Poseidon2::hash2(x, y));
+    }
+}
+BENCHMARK(poseidon2_hash2_bench);
+
+void poseidon2_hash4_bench(State& state) noexcept
+{
+    std::array<grumpkin::fq, 4> inputs;
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    for (auto _ : state) {
+        DoNotOptimize(Poseidon2::hash(inputs));
+    }
+}
+BENCHMARK(poseidon2_hash4_bench);
+
+// A level of a Merkle tree with the given number of parents, one pair at a time vs. batched permutations
+void poseidon2_hash_pair_level_bench(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<grumpkin::fq> children(2 * num_pairs);
+    for (auto& child : children) {
+        child = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> parents(num_pairs);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_pairs; ++i) {
+            parents[i] = Poseidon2::hash_pair(children[2 * i], children[2 * i + 1]);
+        }
+        DoNotOptimize(parents.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_pairs));
+}
+BENCHMARK(poseidon2_hash_pair_level_bench)->Arg(1 << 10)->Arg(1 << 14);
+
+void poseidon2_hash_pairs_level_bench(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<grumpkin::fq> children(2 * num_pairs);
+    for (auto& child : children) {
+        child = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> parents(num_pairs);
+    for (auto _ : state) {
+        Poseidon2::hash_pairs(children, parents);
+        DoNotOptimize(parents.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_pairs));
+}
+BENCHMARK(poseidon2_hash_pairs_level_bench)->Arg(1 << 10)->Arg(1 << 14);
+
+void poseidon2_permutation_batch_bench(State& state) noexcept
+{
+    std::vector<Poseidon2Permutation::State> states(static_cast<size_t>(state.range(0)));
+    for (auto& permutation_state : states) {
+        for (auto& element : permutation_state) {
+            element = grumpkin::fq::random_element();
+        }
+    }
+    for (auto _ : state) {
+        Poseidon2Permutation::permutation_batch(states);
+        DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(states.size()));
+}
+BENCHMARK(poseidon2_permutation_batch_bench)
+    ->Arg(1)
+    ->Arg(static_cast<int64_t>(Poseidon2Permutation::BATCH_SIZE))
+    ->Arg(1 << 10);
+
 BENCHMARK_MAIN();
\ No newline at end of file
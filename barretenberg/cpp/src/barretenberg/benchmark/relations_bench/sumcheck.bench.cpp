@@ -0,0 +1,67 @@
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck_round.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+}
+
+namespace bb::benchmark::relations {
+
+/**
+ * @brief Round 0 of the sumcheck prover, i.e. compute_univariate over full-size random polynomials.
+ * @details Reports the throughput in rows per second per core. The first argument is log2 of the number of rows, the
+ * second one selects the blocked (1) or per-edge (0) evaluation of the round univariate.
+ */
+template <typename Flavor> void sumcheck_round_0(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+
+    const auto log_num_rows = static_cast<size_t>(state.range(0));
+    const size_t num_rows = 1UL << log_num_rows;
+
+    typename Flavor::ProverPolynomials polynomials(num_rows);
+    for (auto& polynomial : polynomials.get_unshifted()) {
+        for (size_t i = polynomial.start_index(); i < polynomial.end_index(); ++i) {
+            polynomial.at(i) = FF::random_element(&engine);
+        }
+    }
+    polynomials.set_shifted();
+
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    std::vector<FF> betas(log_num_rows);
+    for (auto& beta : betas) {
+        beta = FF::random_element(&engine);
+    }
+    GateSeparatorPolynomial<FF> gate_separators(betas, log_num_rows);
+    typename Flavor::RelationSeparator alphas;
+    for (auto& alpha : alphas) {
+        alpha = FF::random_element(&engine);
+    }
+
+    SumcheckProverRound<Flavor> round(num_rows);
+    round.use_blocked_evaluation = state.range(1) != 0;
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(
+            round.compute_univariate(polynomials, relation_parameters, gate_separators, alphas));
+    }
+    state.counters["rows_per_core"] = ::benchmark::Counter(
+        static_cast<double>(num_rows * state.iterations()) / static_cast<double>(get_num_cpus()),
+        ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(sumcheck_round_0<UltraFlavor>)
+    ->ArgsProduct({ { 16, 18, 20 }, { 0, 1 } })
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(sumcheck_round_0<MegaFlavor>)
+    ->ArgsProduct({ { 16, 18, 20 }, { 0, 1 } })
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace bb::benchmark::relations
+
+BENCHMARK_MAIN();
@@ -122,6 +122,50 @@ TEST(UltraCircuitConstructor, BadLookupFailure)
     EXPECT_FALSE(CircuitChecker::check(builder));
 }
 
+/**
+ * @brief Circuits share the contents of the basic tables they use, but each has its own lookups and table indices
+ */
+TEST(UltraCircuitConstructor, SharedLookupTables)
+{
+    const fr left(1);
+    const fr right(5);
+    auto add_lookup = [&](UltraCircuitBuilder& builder, const MultiTableId id) {
+        const auto accumulators = plookup::get_lookup_accumulators(id, left, right, /*is_2_to_1_lookup*/ true);
+        builder.create_gates_from_plookup_accumulators(
+            id, accumulators, builder.add_variable(left), builder.add_variable(right));
+    };
+    auto add_xor = [&](UltraCircuitBuilder& builder) { add_lookup(builder, MultiTableId::UINT32_XOR); };
+
+    UltraCircuitBuilder builder_1;
+    add_xor(builder_1);
+    UltraCircuitBuilder builder_2;
+    // Use other tables first, so that the XOR tables get different indices in the two circuits
+    add_lookup(builder_2, MultiTableId::UINT32_AND);
+    add_xor(builder_2);
+
+    for (const auto& table : builder_1.lookup_tables) {
+        const auto it = std::find_if(builder_2.lookup_tables.begin(),
+                                     builder_2.lookup_tables.end(),
+                                     [&](const auto& other) { return other.id() == table.id(); });
+        ASSERT_NE(it, builder_2.lookup_tables.end());
+        EXPECT_EQ(it->table, table.table);
+        EXPECT_NE(it->table_index, table.table_index);
+        EXPECT_EQ(it->lookup_gates, table.lookup_gates);
+    }
+
+    // Lookups on a copy of a circuit do not show up in the original
+    UltraCircuitBuilder builder_3{ builder_1 };
+    add_xor(builder_3);
+    for (size_t i = 0; i < builder_1.lookup_tables.size(); ++i) {
+        EXPECT_EQ(builder_3.lookup_tables[i].table, builder_1.lookup_tables[i].table);
+        EXPECT_EQ(builder_3.lookup_tables[i].lookup_gates.size(), 2 * builder_1.lookup_tables[i].lookup_gates.size());
+    }
+
+    EXPECT_TRUE(CircuitChecker::check(builder_1));
+    EXPECT_TRUE(CircuitChecker::check(builder_2));
+    EXPECT_TRUE(CircuitChecker::check(builder_3));
+}
+
 TEST(UltraCircuitConstructor, BaseCase)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -25,8 +25,10 @@ template <typename Builder> bool UltraCircuitChecker::check(const Builder& build
     LookupHashTable lookup_hash_table;
     for (const auto& table : builder.lookup_tables) {
         const FF table_index(table.table_index);
+        const auto& basic_table = *table.table;
         for (size_t i = 0; i < table.size(); ++i) {
-            lookup_hash_table.insert({ table.column_1[i], table.column_2[i], table.column_3[i], table_index });
+            lookup_hash_table.insert(
+                { basic_table.column_1[i], basic_table.column_2[i], basic_table.column_3[i], table_index });
         }
     }
 
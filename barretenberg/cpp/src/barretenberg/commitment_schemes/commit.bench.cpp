@@ -247,6 +247,46 @@ template <typename Curve> void bench_commit_mock_z_perm_preprocessed(::benchmark
     }
 }
 
+constexpr size_t BATCH_NUM_POLYS = 256;
+
+// Commit to a batch of dense random polynomials one at a time
+template <typename Curve> void bench_commit_batch_sequential(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < BATCH_NUM_POLYS; ++i) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    for (auto _ : state) {
+        for (auto& polynomial : polynomials) {
+            key->commit(polynomial);
+        }
+    }
+}
+
+// Commit to a batch of dense random polynomials using commit_batch
+template <typename Curve> void bench_commit_batch(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    std::vector<PolynomialSpan<const Fr>> spans;
+    for (size_t i = 0; i < BATCH_NUM_POLYS; ++i) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    for (auto& polynomial : polynomials) {
+        spans.emplace_back(polynomial);
+    }
+    for (auto _ : state) {
+        key->commit_batch(spans);
+    }
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -272,6 +312,8 @@ BENCHMARK(bench_commit_structured_random_poly<curve::BN254>)->Unit(benchmark::kM
 BENCHMARK(bench_commit_structured_random_poly_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_batch_sequential<curve::BN254>)->DenseRange(10, 16, 2)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_batch<curve::BN254>)->DenseRange(10, 16, 2)->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
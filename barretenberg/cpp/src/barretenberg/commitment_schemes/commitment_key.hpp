@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace bb {
@@ -40,6 +41,8 @@ template <class Curve> class CommitmentKey {
     using Commitment = typename Curve::AffineElement;
     using G1 = typename Curve::AffineElement;
     static constexpr size_t EXTRA_SRS_POINTS_FOR_ECCVM_IPA = 1;
+    // Below this many points per thread, a polynomial is committed via the batched msm in commit_batch
+    static constexpr size_t BATCH_COMMIT_POINTS_PER_THREAD = 1UL << 11;
 
     static size_t get_num_needed_srs_points(size_t num_points)
     {
@@ -125,6 +128,60 @@ template <class Curve> class CommitmentKey {
         return point;
     };
 
+    /**
+     * @brief Commit to a batch of polynomials against the shared SRS
+     * @details Polynomials small enough that a standalone pippenger would be dominated by its fork-join schedule and
+     * bucket reduction are committed together by scalar_multiplication::batch_multi_scalar_mul, which walks the point
+     * table once in tiles for all of them within a single parallel pass. Polynomials with at least
+     * BATCH_COMMIT_POINTS_PER_THREAD points per thread already saturate the threads on their own and are committed one
+     * after another with the regular pippenger, reusing the key's runtime state.
+     *
+     * @param polynomials
+     * @return std::vector<Commitment> The commitments, in the same order as the input polynomials
+     */
+    std::vector<Commitment> commit_batch(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        PROFILE_THIS_NAME("commit_batch");
+        const size_t batch_size_threshold = get_num_cpus() * BATCH_COMMIT_POINTS_PER_THREAD;
+
+        std::vector<Commitment> commitments(polynomials.size());
+        std::vector<PolynomialSpan<const Fr>> batched_polynomials;
+        std::vector<size_t> batched_indices;
+        size_t max_end_index = 0;
+        for (size_t idx = 0; idx < polynomials.size(); ++idx) {
+            if (polynomials[idx].size() < batch_size_threshold) {
+                batched_polynomials.emplace_back(polynomials[idx]);
+                batched_indices.emplace_back(idx);
+                max_end_index = std::max(max_end_index, polynomials[idx].end_index());
+            } else {
+                commitments[idx] = commit(polynomials[idx]);
+            }
+        }
+        if (batched_polynomials.empty()) {
+            return commitments;
+        }
+
+        ASSERT(max_end_index <= dyadic_size && "Polynomial size exceeds commitment key size.");
+        auto srs = srs::get_crs_factory<Curve>()->get_prover_crs(max_end_index);
+        if (max_end_index > srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  max_end_index,
+                                  " points with an SRS of size ",
+                                  srs->get_monomial_size()));
+        }
+
+        auto results = scalar_multiplication::batch_multi_scalar_mul<Curve>(batched_polynomials,
+                                                                             srs->get_monomial_points());
+        Curve::Element::batch_normalize(results.data(), results.size());
+        for (auto [idx, result] : zip_view(batched_indices, results)) {
+            commitments[idx] = Commitment(result.x, result.y);
+            if (result.is_point_at_infinity()) {
+                commitments[idx].self_set_infinity();
+            }
+        }
+        return commitments;
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
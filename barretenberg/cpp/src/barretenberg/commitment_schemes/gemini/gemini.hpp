@@ -275,7 +275,7 @@ template <typename Curve> class GeminiProver_ {
                 A_0_neg -= batched_to_be_shifted_by_one; // A₀₋ -= G/r
             }
 
-            return { A_0_pos, A_0_neg };
+            return { std::move(A_0_pos), std::move(A_0_neg) };
         };
         /**
          * @brief Compute the partially evaluated polynomials P₊(X, r) and P₋(X, -r)
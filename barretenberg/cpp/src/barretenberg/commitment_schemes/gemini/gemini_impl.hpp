@@ -75,12 +75,24 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
 
     // Construct the d-1 Gemini foldings of A₀(X)
     std::vector<Polynomial> fold_polynomials = compute_fold_polynomials(log_n, multilinear_challenge, A_0);
+    // A₀ itself is not opened; free it before the partially evaluated batch polynomials are allocated
+    A_0.clear();
+
+    // Commit to all folds at once. The large ones are still committed one after another, each using all threads, but
+    // the sizes halve with every fold, and the small ones at the tail (which on their own would leave most threads
+    // idle) share a single multi-MSM.
+    std::vector<PolynomialSpan<const Fr>> fold_spans;
+    fold_spans.reserve(fold_polynomials.size());
+    for (const auto& fold_polynomial : fold_polynomials) {
+        fold_spans.emplace_back(fold_polynomial);
+    }
+    const std::vector<Commitment> fold_commitments = commitment_key->commit_batch(fold_spans);
 
     // If virtual_log_n >= log_n, pad the fold commitments with dummy group elements [1]_1.
     for (size_t l = 0; l < virtual_log_n - 1; l++) {
         std::string label = "Gemini:FOLD_" + std::to_string(l + 1);
         if (l < log_n - 1) {
-            transcript->send_to_verifier(label, commitment_key->commit(fold_polynomials[l]));
+            transcript->send_to_verifier(label, fold_commitments[l]);
         } else {
             transcript->send_to_verifier(label, Commitment::one());
         }
@@ -145,15 +157,24 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
     constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
                                                            // would be a point in sending them to a separate thread
 
-    // Reserve and allocate space for m-1 Fold polynomials, the foldings of the full batched polynomial A₀
+    // Reserve and allocate space for m-1 Fold polynomials, the foldings of the full batched polynomial A₀.
+    // Their sizes n/2, n/4, ..., 2 add up to n - 2, so they are adjacent slices of a single allocation.
+    // Every coefficient is written below, so there is no need to zero the memory first
     std::vector<Polynomial> fold_polynomials;
     fold_polynomials.reserve(log_n - 1);
-    for (size_t l = 0; l < log_n - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (log_n - l - 1);
+    if (log_n > 1) {
+        const size_t n = 1 << log_n;
+        auto fold_memory = _allocate_aligned_memory<Fr>(n - 2);
+        size_t offset = 0;
+        for (size_t l = 0; l < log_n - 1; ++l) {
+            // size of the previous polynomial/2
+            const size_t n_l = 1 << (log_n - l - 1);
 
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        fold_polynomials.emplace_back(Polynomial(n_l));
+            // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+            fold_polynomials.emplace_back(std::shared_ptr<Fr[]>(fold_memory, fold_memory.get() + offset), n_l, n_l);
+            offset += n_l;
+        }
     }
 
     // A_l = Aₗ(X) is the polynomial being folded
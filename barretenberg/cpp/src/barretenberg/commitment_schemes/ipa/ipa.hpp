@@ -327,6 +327,63 @@ template <typename Curve_> class IPA {
                                                       auto& transcript)
         requires(!Curve::is_stdlib_type)
     {
+        // Steps 1-6 and 9, which do not depend on the SRS
+        const NativeReduction reduction = reduce_native_claim(vk, opening_claim, transcript);
+
+        // Step 7.
+        // Construct vector s
+        Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(reduction.log_poly_length, reduction.u_challenges_inv()));
+
+        // Step 8.
+        // Compute G₀
+        const std::vector<Commitment> G_vec_local = get_srs_for_ipa(vk, s_poly.size());
+        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+           s_poly, {&G_vec_local[0], /*size*/ s_poly.size()}, vk->pippenger_runtime_state);
+        ASSERT(G_zero == reduction.G_zero_sent && "G_0 should be equal to G_0 sent in transcript.");
+
+        // Steps 10 and 11.
+        return reduction.check(G_zero);
+    }
+
+    /**
+     * @brief The result of running the native verifier on a claim up to (but excluding) the computation of G₀
+     *
+     * @details Everything here costs O(log n) group operations, the only linear part of the verification is checking
+     * that G₀ = <s, G>.
+     */
+    struct NativeReduction {
+        size_t log_poly_length = 0;
+        std::vector<Fr> round_challenges_inv;
+        Commitment aux_generator;
+        // C₀ = C' + ∑_{j ∈ [k]} u_j^{-1}L_j + ∑_{j ∈ [k]} u_jR_j
+        GroupElement C_zero;
+        Fr b_zero;
+        Commitment G_zero_sent;
+        Fr a_zero;
+
+        std::span<const Fr> u_challenges_inv() const
+        {
+            return std::span(round_challenges_inv).subspan(0, log_poly_length);
+        }
+
+        // Check that C₀ = a₀G₀ + a₀b₀U for the given G₀
+        bool check(const Commitment& G_zero) const
+        {
+            GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+            return (C_zero.normalize() == right_hand_side.normalize());
+        }
+    };
+
+    /**
+     * @brief Steps 1-6 and 9 of the native verifier (see reduce_verify_internal_native), receiving G₀ from the prover
+     * instead of computing it
+     */
+    static NativeReduction reduce_native_claim(const std::shared_ptr<VK>& vk,
+                                               const OpeningClaim<Curve>& opening_claim,
+                                               auto& transcript)
+        requires(!Curve::is_stdlib_type)
+    {
+        NativeReduction reduction;
         // Step 1.
         // Receive polynomial_degree + 1 = d from the prover
         auto poly_length = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
@@ -342,19 +399,21 @@ template <typename Curve_> class IPA {
             throw_or_abort("The generator challenge can't be zero");
         }
 
-        Commitment aux_generator = Commitment::one() * generator_challenge;
+        reduction.aux_generator = Commitment::one() * generator_challenge;
 
         auto log_poly_length = static_cast<size_t>(numeric::get_msb(poly_length));
         if (log_poly_length > CONST_ECCVM_LOG_N) {
             throw_or_abort("IPA log_poly_length is too large " + std::to_string(log_poly_length));
         }
+        reduction.log_poly_length = log_poly_length;
         // Step 3.
         // Compute C' = C + f(\beta) ⋅ U
-        GroupElement C_prime = opening_claim.commitment + (aux_generator * opening_claim.opening_pair.evaluation);
+        GroupElement C_prime = opening_claim.commitment + (reduction.aux_generator * opening_claim.opening_pair.evaluation);
 
         auto pippenger_size = 2 * log_poly_length;
         std::vector<Fr> round_challenges(CONST_ECCVM_LOG_N);
-        std::vector<Fr> round_challenges_inv(CONST_ECCVM_LOG_N);
+        std::vector<Fr>& round_challenges_inv = reduction.round_challenges_inv;
+        round_challenges_inv.resize(CONST_ECCVM_LOG_N);
         std::vector<Commitment> msm_elements(pippenger_size);
         std::vector<Fr> msm_scalars(pippenger_size);
 
@@ -383,55 +442,59 @@ template <typename Curve_> class IPA {
         // Compute C₀ = C' + ∑_{j ∈ [k]} u_j^{-1}L_j + ∑_{j ∈ [k]} u_jR_j
         GroupElement LR_sums = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
             {0, {&msm_scalars[0], /*size*/ pippenger_size}}, {&msm_elements[0], /*size*/ pippenger_size}, vk->pippenger_runtime_state);
-        GroupElement C_zero = C_prime + LR_sums;
+        reduction.C_zero = C_prime + LR_sums;
 
         //  Step 6.
         // Compute b_zero where b_zero can be computed using the polynomial:
         //  g(X) = ∏_{i ∈ [k]} (1 + u_{i-1}^{-1}.X^{2^{i-1}}).
         //  b_zero = g(evaluation) = ∏_{i ∈ [k]} (1 + u_{i-1}^{-1}. (evaluation)^{2^{i-1}})
-        Fr b_zero = Fr::one();
-        for (size_t i = 0; i < log_poly_length; i++) {
-            b_zero *= Fr::one() + (round_challenges_inv[log_poly_length - 1 - i] *
-                                   opening_claim.opening_pair.challenge.pow(1 << i));
-        }
+        reduction.b_zero = evaluate_challenge_poly_native(reduction.u_challenges_inv(), opening_claim.opening_pair.challenge);
 
-        // Step 7.
-        // Construct vector s
-        Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(log_poly_length, std::span(round_challenges_inv).subspan(0, log_poly_length)));
+        // Receive G₀ from the prover
+        reduction.G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
+
+        // Step 9.
+        // Receive a₀ from the prover
+        reduction.a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        return reduction;
+    }
 
+    /**
+     * @brief Copy the first num_points points of the SRS to local memory
+     *
+     * @details The SRS stored in the commitment key is the result after applying the pippenger point table so the
+     * values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism.
+     * We need only the original SRS thus we extract only the even indices.
+     */
+    static std::vector<Commitment> get_srs_for_ipa(const std::shared_ptr<VK>& vk, size_t num_points)
+    {
         std::span<const Commitment> srs_elements = vk->get_monomial_points();
-        if (poly_length * 2 > srs_elements.size()) {
+        if (num_points * 2 > srs_elements.size()) {
             throw_or_abort("potential bug: Not enough SRS points for IPA!");
         }
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_length);
-
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
+        std::vector<Commitment> G_vec_local(num_points);
         parallel_for_heuristic(
-            poly_length,
+            num_points,
             [&](size_t i) {
                 G_vec_local[i] = srs_elements[i * 2];
             }, thread_heuristics::FF_COPY_COST * 2);
+        return G_vec_local;
+    }
 
-        // Step 8.
-        // Compute G₀
-        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-           s_poly, {&G_vec_local[0], /*size*/ poly_length}, vk->pippenger_runtime_state);
-        Commitment G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
-        ASSERT(G_zero == G_zero_sent && "G_0 should be equal to G_0 sent in transcript.");
-
-        // Step 9.
-        // Receive a₀ from the prover
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
-
-        // Step 10.
-        // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
-        // Step 11.
-        // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+    /**
+     * @brief Evaluates challenge_poly(X) = ∏_{i ∈ [k]} (1 + u_{k-i}^{-1}.X^{2^{i-1}}) at r, natively
+     */
+    static Fr evaluate_challenge_poly_native(std::span<const Fr> u_challenges_inv, const Fr& r)
+        requires(!Curve::is_stdlib_type)
+    {
+        const size_t log_poly_length = u_challenges_inv.size();
+        Fr result = Fr::one();
+        Fr r_pow = r;
+        for (size_t i = 0; i < log_poly_length; i++) {
+            result *= Fr::one() + (u_challenges_inv[log_poly_length - 1 - i] * r_pow);
+            r_pow.self_sqr();
+        }
+        return result;
     }
     /**
      * @brief  Recursively verify the correctness of an IPA proof, without computing G_zero. Unlike native verification, there is no
@@ -577,6 +640,131 @@ template <typename Curve_> class IPA {
         return reduce_verify_internal_native(vk, opening_claim, transcript);
     }
 
+    /**
+     * @brief Natively verify several IPA proofs with a single SRS-sized MSM
+     *
+     * @details Verifying a single proof is dominated by the MSM G₀ = <s, G>, where s is determined by the round
+     * challenges. Here, every claim is checked against the G₀ sent by its prover, which only costs O(log n) group
+     * operations per claim. All the sent G₀ are then checked at once with random weights ρ_j, i.e.
+     * ∑ ρ_j G₀_j = <∑ ρ_j s_j, G>, so that the linear-time work is done once for the whole batch.
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims The claims to verify
+     * @param transcripts One verifier transcript per claim, initialized with its proof
+     * @return true iff all proofs verify
+     */
+    static bool batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                    const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                    const std::vector<std::shared_ptr<NativeTranscript>>& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        if (opening_claims.size() != transcripts.size()) {
+            throw_or_abort("IPA batch verification needs one transcript per claim");
+        }
+        if (opening_claims.empty()) {
+            return true;
+        }
+
+        std::vector<NativeReduction> reductions;
+        reductions.reserve(opening_claims.size());
+        size_t batched_poly_length = 0;
+        for (size_t j = 0; j < opening_claims.size(); j++) {
+            reductions.emplace_back(reduce_native_claim(vk, opening_claims[j], transcripts[j]));
+            batched_poly_length = std::max(batched_poly_length, size_t{ 1 } << reductions.back().log_poly_length);
+        }
+
+        // Check each claim against its sent G₀ and fold the s vectors (and the sent G₀) with random weights
+        bool claims_verify = true;
+        Polynomial<Fr> batched_s_poly(batched_poly_length);
+        GroupElement batched_G_zero_sent;
+        batched_G_zero_sent.self_set_infinity();
+        for (const auto& reduction : reductions) {
+            claims_verify = claims_verify && reduction.check(reduction.G_zero_sent);
+            const Fr weight = Fr::random_element();
+            batched_s_poly.add_scaled(
+                construct_poly_from_u_challenges_inv(reduction.log_poly_length, reduction.u_challenges_inv()), weight);
+            batched_G_zero_sent += reduction.G_zero_sent * weight;
+        }
+        if (!claims_verify) {
+            return false;
+        }
+
+        // The only SRS-sized MSM of the batch
+        const std::vector<Commitment> G_vec_local = get_srs_for_ipa(vk, batched_poly_length);
+        Commitment batched_G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+            batched_s_poly, {&G_vec_local[0], /*size*/ batched_poly_length}, vk->pippenger_runtime_state);
+        return batched_G_zero == Commitment(batched_G_zero_sent);
+    }
+
+    /**
+     * @brief Natively accumulate several IPA claims into one, and compute an IPA proof for the accumulated claim
+     *
+     * @details The native counterpart of the recursive accumulate below, for any number of claims: each claim is
+     * verified up to G₀, which becomes the commitment to its challenge polynomial s_j. The accumulated claim is the
+     * opening of ∑ α^j s_j at a challenge r, with commitment ∑ α^j G₀_j. Verifying it costs a single SRS-sized MSM,
+     * which is thereby deferred (and amortized) to whoever verifies the accumulator.
+     *
+     * @param ck Commitment key large enough for the longest of the claims
+     * @param vk Verification_key containing pippenger_runtime_state to be used for MSM
+     * @param opening_claims The claims to accumulate
+     * @param transcripts One verifier transcript per claim, initialized with its proof
+     * @return std::pair<OpeningClaim<Curve>, HonkProof> The accumulated claim and its IPA proof
+     */
+    static std::pair<OpeningClaim<Curve>, HonkProof> accumulate(const std::shared_ptr<CK>& ck,
+                                                                const std::shared_ptr<VK>& vk,
+                                                                const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                                                const std::vector<std::shared_ptr<NativeTranscript>>& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        if (opening_claims.size() != transcripts.size() || opening_claims.empty()) {
+            throw_or_abort("IPA accumulation needs at least one claim and one transcript per claim");
+        }
+
+        // Step 1: Run the verifier for each IPA instance, except for the G₀ computation
+        std::vector<NativeReduction> reductions;
+        reductions.reserve(opening_claims.size());
+        size_t accumulated_poly_length = 0;
+        for (size_t j = 0; j < opening_claims.size(); j++) {
+            reductions.emplace_back(reduce_native_claim(vk, opening_claims[j], transcripts[j]));
+            if (!reductions.back().check(reductions.back().G_zero_sent)) {
+                throw_or_abort("IPA claim " + std::to_string(j) + " does not verify");
+            }
+            accumulated_poly_length =
+                std::max(accumulated_poly_length, size_t{ 1 } << reductions.back().log_poly_length);
+        }
+
+        // Step 2: Generate the challenges by hashing the reduced claims
+        NativeTranscript transcript;
+        for (size_t j = 0; j < reductions.size(); j++) {
+            transcript.send_to_verifier("u_challenges_inv_" + std::to_string(j), reductions[j].round_challenges_inv);
+            transcript.send_to_verifier("U_" + std::to_string(j), reductions[j].G_zero_sent);
+        }
+        auto [alpha, r] = transcript.template get_challenges<Fr>("IPA:alpha", "IPA:r");
+
+        // Step 3: Compute the new accumulator and its polynomial
+        OpeningClaim<Curve> output_claim;
+        output_claim.opening_pair.challenge = r;
+        output_claim.opening_pair.evaluation = Fr::zero();
+        GroupElement commitment;
+        commitment.self_set_infinity();
+        Polynomial<Fr> challenge_poly(accumulated_poly_length);
+        Fr alpha_pow = Fr::one();
+        for (const auto& reduction : reductions) {
+            commitment += reduction.G_zero_sent * alpha_pow;
+            output_claim.opening_pair.evaluation += alpha_pow * evaluate_challenge_poly_native(reduction.u_challenges_inv(), r);
+            challenge_poly.add_scaled(
+                construct_poly_from_u_challenges_inv(reduction.log_poly_length, reduction.u_challenges_inv()), alpha_pow);
+            alpha_pow *= alpha;
+        }
+        output_claim.commitment = commitment;
+        ASSERT(challenge_poly.evaluate(r) == output_claim.opening_pair.evaluation && "Opening claim does not hold for challenge polynomial.");
+
+        // Step 4: Compute proof for the claim
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        compute_opening_proof(ck, { challenge_poly, output_claim.opening_pair }, prover_transcript);
+        return { output_claim, prover_transcript->proof_data };
+    }
+
     /**
      * @brief Recursively verify the correctness of a proof
      *
@@ -244,6 +244,103 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    // Proofs for polynomials of different sizes
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<HonkProof> proofs;
+    for (size_t poly_length : { n, n / 2, small_n, n }) {
+        auto poly = Polynomial::random(poly_length);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, ck->commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        PCS::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        proofs.push_back(prover_transcript->proof_data);
+    }
+    const auto verifier_transcripts = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+        for (const auto& proof : proofs) {
+            transcripts.push_back(std::make_shared<NativeTranscript>(proof));
+        }
+        return transcripts;
+    };
+
+    EXPECT_TRUE(PCS::batch_reduce_verify(vk, opening_claims, verifier_transcripts()));
+
+    // A wrong evaluation in one of the claims makes the batch fail
+    auto bad_claims = opening_claims;
+    bad_claims[2].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(PCS::batch_reduce_verify(vk, bad_claims, verifier_transcripts()));
+}
+
+/**
+ * @brief A claim whose sent G₀ is not <s, G> passes its own check C₀ = a₀G₀ + a₀b₀U, but fails the batched MSM
+ * @details The commitment is not hashed into the transcript and G₀ is sent last, so shifting G₀ by Δ and the commitment
+ * by a₀Δ leaves all challenges unchanged and keeps C₀ = a₀G₀ + a₀b₀U.
+ */
+TEST_F(IPATest, BatchVerifyWrongGZero)
+{
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<HonkProof> proofs;
+    for (size_t poly_length : { n, small_n, n / 2 }) {
+        auto poly = Polynomial::random(poly_length);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, ck->commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        PCS::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        proofs.push_back(prover_transcript->proof_data);
+    }
+
+    // The proof ends with G₀ and a₀
+    auto& bad_proof = proofs[1];
+    constexpr size_t frs_per_Fr = bb::field_conversion::calc_num_bn254_frs<Fr>();
+    constexpr size_t frs_per_G = bb::field_conversion::calc_num_bn254_frs<Commitment>();
+    const size_t G_zero_start = bad_proof.size() - frs_per_Fr - frs_per_G;
+    const std::span<const bb::fr> proof_span(bad_proof);
+    const auto G_zero =
+        bb::field_conversion::convert_from_bn254_frs<Commitment>(proof_span.subspan(G_zero_start, frs_per_G));
+    const auto a_zero = bb::field_conversion::convert_from_bn254_frs<Fr>(proof_span.subspan(G_zero_start + frs_per_G));
+
+    const GroupElement delta = GroupElement::random_element();
+    const auto bad_G_zero = bb::field_conversion::convert_to_bn254_frs(Commitment(G_zero + delta));
+    std::copy(bad_G_zero.begin(), bad_G_zero.end(), bad_proof.begin() + static_cast<std::ptrdiff_t>(G_zero_start));
+    opening_claims[1].commitment = opening_claims[1].commitment + delta * a_zero;
+
+    const auto verifier_transcripts = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+        for (const auto& proof : proofs) {
+            transcripts.push_back(std::make_shared<NativeTranscript>(proof));
+        }
+        return transcripts;
+    };
+
+    // The claim passes its own check, which is all that accumulation does per claim
+    EXPECT_NO_THROW(PCS::accumulate(ck, vk, opening_claims, verifier_transcripts()));
+    EXPECT_FALSE(PCS::batch_reduce_verify(vk, opening_claims, verifier_transcripts()));
+}
+
+TEST_F(IPATest, NativeAccumulate)
+{
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+    for (size_t poly_length : { n, small_n, n / 2 }) {
+        auto poly = Polynomial::random(poly_length);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, ck->commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        PCS::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        verifier_transcripts.push_back(std::make_shared<NativeTranscript>(prover_transcript->proof_data));
+    }
+
+    auto [accumulated_claim, proof] = PCS::accumulate(ck, vk, opening_claims, verifier_transcripts);
+
+    auto verifier_transcript = std::make_shared<NativeTranscript>(proof);
+    EXPECT_TRUE(PCS::reduce_verify(vk, accumulated_claim, verifier_transcript));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     // Generate multilinear polynomials, their commitments (genuine and mocked) and evaluations (genuine) at a random
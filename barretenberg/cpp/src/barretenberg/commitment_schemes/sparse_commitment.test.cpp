@@ -390,4 +390,40 @@ TYPED_TEST(CommitmentKeyTest, CommitStructuredNonzeroComplement)
     EXPECT_EQ(result, expected_result);
 }
 
+/**
+ * @brief Test that commit_batch agrees with committing to each polynomial individually, for a mix of small, offset,
+ * zero and full size polynomials (the latter taking the regular pippenger
+ * path when few threads are available).
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, CommitBatch)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 16;
+    std::vector<Polynomial> polynomials;
+    polynomials.emplace_back(Polynomial::random(1));
+    polynomials.emplace_back(Polynomial::random(num_points));
+    polynomials.emplace_back(Polynomial::random(300, num_points, 5));
+    polynomials.emplace_back(Polynomial::random(9000, num_points, 9000));
+    polynomials.emplace_back(Polynomial::random(num_points / 2, num_points, num_points / 2));
+    polynomials.emplace_back(Polynomial(1000, num_points, 0));
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+
+    std::vector<PolynomialSpan<const Fr>> spans;
+    for (auto& polynomial : polynomials) {
+        spans.emplace_back(polynomial);
+    }
+    auto batch_commitments = key->commit_batch(spans);
+
+    ASSERT_EQ(batch_commitments.size(), polynomials.size());
+    for (size_t idx = 0; idx < polynomials.size(); ++idx) {
+        EXPECT_EQ(batch_commitments[idx], key->commit(polynomials[idx]));
+    }
+}
+
 } // namespace bb
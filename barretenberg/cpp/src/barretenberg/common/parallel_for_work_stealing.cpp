@@ -0,0 +1,180 @@
+#ifndef NO_MULTITHREADING
+#include "barretenberg/common/compiler_hints.hpp"
+#include "thread.hpp"
+#include "work_stealing_scheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+// The scheduler (if any) for which the current thread is a worker, and the index of its deque
+thread_local const bb::WorkStealingScheduler* current_scheduler = nullptr;
+thread_local size_t current_worker_idx = 0;
+} // namespace
+
+namespace bb {
+
+WorkStealingScheduler::WorkStealingScheduler(size_t num_workers)
+{
+    deques.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        deques.emplace_back(std::make_unique<TaskDeque>());
+    }
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingScheduler::worker_loop, this, i);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    wake_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+WorkStealingScheduler& WorkStealingScheduler::get()
+{
+    static WorkStealingScheduler scheduler(get_num_cpus() - 1);
+    return scheduler;
+}
+
+size_t WorkStealingScheduler::home_deque_index() const
+{
+    return current_scheduler == this ? current_worker_idx : deques.size() - 1;
+}
+
+void WorkStealingScheduler::submit(Task task, size_t num_copies)
+{
+    if (num_copies == 0) {
+        return;
+    }
+    {
+        TaskDeque& deque = *deques[home_deque_index()];
+        std::unique_lock<std::mutex> lock(deque.mutex);
+        for (size_t i = 1; i < num_copies; ++i) {
+            deque.tasks.push_back(task);
+        }
+        deque.tasks.push_back(std::move(task));
+        num_pending_tasks.fetch_add(num_copies, std::memory_order_release);
+    }
+    // Synchronise with sleeping workers so that the wake-up cannot be lost between their check and their wait
+    { std::unique_lock<std::mutex> lock(sleep_mutex); }
+    if (num_copies == 1) {
+        wake_condition.notify_one();
+    } else {
+        wake_condition.notify_all();
+    }
+}
+
+std::optional<WorkStealingScheduler::Task> WorkStealingScheduler::pop_task(size_t home_idx)
+{
+    if (num_pending_tasks.load(std::memory_order_acquire) == 0) {
+        return std::nullopt;
+    }
+    // Newest task from our own deque first
+    {
+        TaskDeque& deque = *deques[home_idx];
+        std::unique_lock<std::mutex> lock(deque.mutex);
+        if (!deque.tasks.empty()) {
+            Task task = std::move(deque.tasks.back());
+            deque.tasks.pop_back();
+            num_pending_tasks.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    // Otherwise steal the oldest task of another deque
+    for (size_t offset = 1; offset < deques.size(); ++offset) {
+        TaskDeque& deque = *deques[(home_idx + offset) % deques.size()];
+        std::unique_lock<std::mutex> lock(deque.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || deque.tasks.empty()) {
+            continue;
+        }
+        Task task = std::move(deque.tasks.front());
+        deque.tasks.pop_front();
+        num_pending_tasks.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+    return std::nullopt;
+}
+
+bool WorkStealingScheduler::try_run_one()
+{
+    std::optional<Task> task = pop_task(home_deque_index());
+    if (!task) {
+        return false;
+    }
+    (*task)();
+    return true;
+}
+
+BB_NO_PROFILE void WorkStealingScheduler::worker_loop(size_t worker_idx)
+{
+    current_scheduler = this;
+    current_worker_idx = worker_idx;
+    while (true) {
+        if (try_run_one()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        wake_condition.wait(lock, [this] { return stop || num_pending_tasks.load(std::memory_order_acquire) != 0; });
+        if (stop) {
+            break;
+        }
+    }
+}
+
+/**
+ * A work-stealing strategy. The calling thread and up to num_iterations - 1 helper tasks claim iterations from a shared
+ * atomic counter, so the load balances itself at the granularity of single iterations. The helper tasks go into the
+ * caller's own deque and are stolen by idle workers; while the caller waits for the last iterations it executes other
+ * pending tasks. Calls may therefore be nested, and may be made concurrently from several threads.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    WorkStealingScheduler& scheduler = WorkStealingScheduler::get();
+    const size_t num_helpers = std::min(scheduler.num_workers(), num_iterations > 0 ? num_iterations - 1 : 0);
+    if (num_helpers == 0) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    // Shared with the helper tasks, which may only be dequeued after this call has returned. They only touch `func`
+    // after claiming an iteration, which cannot happen once all iterations are done.
+    struct LoopState {
+        std::atomic<size_t> next_iteration = 0;
+        std::atomic<size_t> num_completed = 0;
+        size_t num_iterations = 0;
+        const std::function<void(size_t)>* func = nullptr;
+
+        void run_iterations()
+        {
+            size_t iteration = 0;
+            while ((iteration = next_iteration.fetch_add(1, std::memory_order_relaxed)) < num_iterations) {
+                (*func)(iteration);
+                num_completed.fetch_add(1, std::memory_order_acq_rel);
+            }
+        }
+    };
+    auto state = std::make_shared<LoopState>();
+    state->num_iterations = num_iterations;
+    state->func = &func;
+
+    scheduler.submit([state]() { state->run_iterations(); }, num_helpers);
+    state->run_iterations();
+    scheduler.help_until(
+        [&state, num_iterations]() { return state->num_completed.load(std::memory_order_acquire) == num_iterations; });
+}
+} // namespace bb
+#endif
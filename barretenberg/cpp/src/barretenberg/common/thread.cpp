@@ -34,6 +34,12 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the above are a fork-join barrier per call, and mutex_pool refuses nested calls, so e.g. an MSM
+ * inside a parallel loop has to run single threaded. "work_stealing" runs on a scheduler with per-thread task deques
+ * (see work_stealing_scheduler.hpp) on which loops may be nested, called from several threads at once, and mixed with
+ * asynchronous tasks (spawn_task). Iterations are claimed one at a time so there is no static partitioning to cause an
+ * idle tail. Defaulting to work_stealing.
  */
 
 namespace bb {
@@ -69,6 +75,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,7 +90,8 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
 #endif
 #endif
@@ -26,6 +26,7 @@ inline size_t get_num_cpus_pow2()
  * @param func Function to run in parallel
  * Observe that num_iterations is NOT the thread pool size.
  * The size will be chosen based on the hardware concurrency (i.e., env or cpus).
+ * Calls may be nested: an inner parallel_for is distributed over whichever threads are idle.
  */
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
 void parallel_for_range(size_t num_points,
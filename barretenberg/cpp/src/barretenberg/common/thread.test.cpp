@@ -0,0 +1,113 @@
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/common/work_stealing_scheduler.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+TEST(Thread, ParallelForRunsEveryIterationOnce)
+{
+    constexpr size_t num_iterations = 10000;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+
+    parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+
+    for (const auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    constexpr size_t num_outer = 16;
+    constexpr size_t num_inner = 257;
+    std::vector<std::atomic<size_t>> counts(num_outer * num_inner);
+
+    parallel_for(num_outer, [&](size_t i) {
+        parallel_for(num_inner, [&](size_t j) { counts[i * num_inner + j]++; });
+    });
+
+    for (const auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+TEST(Thread, ParallelForFromSeveralThreads)
+{
+    constexpr size_t num_callers = 4;
+    constexpr size_t num_iterations = 1000;
+    std::vector<std::atomic<size_t>> counts(num_callers * num_iterations);
+
+    std::vector<std::thread> callers;
+    for (size_t caller = 0; caller < num_callers; ++caller) {
+        callers.emplace_back([&, caller]() {
+            for (size_t repetition = 0; repetition < 10; ++repetition) {
+                parallel_for(num_iterations, [&](size_t i) { counts[caller * num_iterations + i]++; });
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+
+    for (const auto& count : counts) {
+        EXPECT_EQ(count.load(), 10UL);
+    }
+}
+
+TEST(Thread, SpawnTaskDependencies)
+{
+    constexpr size_t num_elements = 1 << 12;
+    std::vector<size_t> values(num_elements);
+
+    // fill -> sum, and sum of squares, both feeding combined; with parallel_for calls inside the tasks
+    auto fill = spawn_task([&]() { parallel_for(num_elements, [&](size_t i) { values[i] = i; }); });
+    auto sum = spawn_task([&]() {
+        fill.get();
+        return std::accumulate(values.begin(), values.end(), 0UL);
+    });
+    auto sum_of_squares = spawn_task([&]() {
+        std::vector<size_t> squares(num_elements);
+        parallel_for(num_elements, [&](size_t i) { squares[i] = i * i; });
+        return std::accumulate(squares.begin(), squares.end(), 0UL);
+    });
+    auto combined = spawn_task([&]() { return sum.get() + sum_of_squares.get(); });
+
+    const size_t expected_sum = num_elements * (num_elements - 1) / 2;
+    const size_t expected_sum_of_squares = (num_elements - 1) * num_elements * (2 * num_elements - 1) / 6;
+    EXPECT_EQ(combined.get(), expected_sum + expected_sum_of_squares);
+}
+
+TEST(Thread, ThreadPoolParallelForFromPoolTasks)
+{
+    constexpr size_t num_tasks = 8;
+    constexpr size_t num_iterations = 513;
+    std::vector<std::atomic<size_t>> counts(num_tasks * num_iterations);
+
+    // More tasks than workers, each of which runs a parallel_for on the same (fully occupied) pool
+    ThreadPool pool(2);
+    for (size_t task = 0; task < num_tasks; ++task) {
+        pool.enqueue([&, task]() {
+            pool.parallel_for(num_iterations, [&](size_t i) { counts[task * num_iterations + i]++; });
+        });
+    }
+    pool.wait();
+
+    for (const auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+#ifndef BB_NO_EXCEPTIONS
+TEST(Thread, SpawnTaskPropagatesExceptions)
+{
+    auto failing = spawn_task([]() -> size_t { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+#endif
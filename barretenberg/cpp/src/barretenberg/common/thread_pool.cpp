@@ -3,6 +3,8 @@
 
 #include "thread_pool.hpp"
 #include "barretenberg/common/log.hpp"
+#include <algorithm>
+#include <memory>
 namespace bb {
 
 ThreadPool::ThreadPool(size_t num_threads)
@@ -40,6 +42,49 @@ void ThreadPool::wait()
     finished_condition.wait(lock, [this] { return tasks.empty() && tasks_running == 0; });
 }
 
+void ThreadPool::parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    const size_t num_helpers = std::min(workers.size(), num_iterations > 0 ? num_iterations - 1 : 0);
+    if (num_helpers == 0) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    // Shared with the helper tasks, which may only be dequeued after this call has returned. They only touch `func`
+    // after claiming an iteration, which cannot happen once all iterations are done.
+    struct LoopState {
+        std::atomic<size_t> next_iteration = 0;
+        std::atomic<size_t> num_completed = 0;
+        size_t num_iterations = 0;
+        const std::function<void(size_t)>* func = nullptr;
+
+        void run_iterations()
+        {
+            size_t iteration = 0;
+            while ((iteration = next_iteration.fetch_add(1, std::memory_order_relaxed)) < num_iterations) {
+                (*func)(iteration);
+                if (num_completed.fetch_add(1, std::memory_order_acq_rel) + 1 == num_iterations) {
+                    num_completed.notify_all();
+                }
+            }
+        }
+    };
+    auto state = std::make_shared<LoopState>();
+    state->num_iterations = num_iterations;
+    state->func = &func;
+
+    for (size_t i = 0; i < num_helpers; ++i) {
+        enqueue([state]() { state->run_iterations(); });
+    }
+    state->run_iterations();
+    size_t num_completed = 0;
+    while ((num_completed = state->num_completed.load(std::memory_order_acquire)) != num_iterations) {
+        state->num_completed.wait(num_completed, std::memory_order_acquire);
+    }
+}
+
 void ThreadPool::worker_loop(size_t /*unused*/)
 {
     // info("created worker ", worker_num);
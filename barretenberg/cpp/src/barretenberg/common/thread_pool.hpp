@@ -22,6 +22,14 @@ class ThreadPool {
 
     void enqueue(const std::function<void()>& task);
     void wait();
+
+    /**
+     * @brief Run func(0), ..., func(num_iterations - 1) on this pool and return once all of them have completed.
+     * @details The calling thread takes part in the loop and only waits for iterations that another thread has already
+     * started, never for queued tasks. It is therefore safe to call from within a task running on this pool, even when
+     * all workers are busy.
+     */
+    void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
     size_t num_threads() { return workers.size(); };
 
   private:
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace bb {
+
+#ifndef NO_MULTITHREADING
+/**
+ * @brief A work-stealing task scheduler.
+ *
+ * @details Every worker thread owns a deque of tasks. A worker pushes and pops at the back of its own deque (LIFO,
+ * which keeps the data of freshly spawned nested tasks hot in cache) and, once that is empty, steals from the front of
+ * the other deques (FIFO, which tends to take the oldest and so largest outstanding pieces of work). Threads that are
+ * not workers of this scheduler submit into a shared injection deque.
+ *
+ * A thread that has to wait for a task (TaskFuture::get, or the end of a parallel_for) keeps executing pending tasks
+ * while it waits (see help_until). Nested parallelism therefore neither deadlocks nor serializes: the inner tasks are
+ * picked up by whichever threads are idle, including the waiting one.
+ */
+class WorkStealingScheduler {
+  public:
+    using Task = std::function<void()>;
+
+    explicit WorkStealingScheduler(size_t num_workers);
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler(WorkStealingScheduler&& other) = delete;
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler& operator=(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler& operator=(WorkStealingScheduler&& other) = delete;
+
+    /**
+     * @brief The process-wide scheduler, with get_num_cpus() - 1 workers (the calling thread is expected to help).
+     */
+    static WorkStealingScheduler& get();
+
+    void submit(Task task) { submit(std::move(task), 1); }
+
+    /**
+     * @brief Submit `num_copies` copies of the same task with a single lock and wake-up.
+     */
+    void submit(Task task, size_t num_copies);
+
+    /**
+     * @brief Execute one pending task on the calling thread. Returns false if there was nothing to run.
+     */
+    bool try_run_one();
+
+    /**
+     * @brief Execute pending tasks on the calling thread until `is_done()` holds.
+     */
+    template <typename Predicate> void help_until(const Predicate& is_done)
+    {
+        while (!is_done()) {
+            if (!try_run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    size_t num_workers() const { return workers.size(); }
+
+  private:
+    struct TaskDeque {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // One deque per worker, followed by the injection deque used by all other threads
+    std::vector<std::unique_ptr<TaskDeque>> deques;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> num_pending_tasks = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable wake_condition;
+    bool stop = false;
+
+    void worker_loop(size_t worker_idx);
+    size_t home_deque_index() const;
+    std::optional<Task> pop_task(size_t home_idx);
+};
+#endif
+
+/**
+ * @brief Handle to the result of a task started with spawn_task.
+ * @details get() blocks until the task has run, executing other pending tasks in the meantime, then returns the task's
+ * result (or rethrows its exception). As with std::future, get() may only be called once.
+ */
+template <typename T> class TaskFuture {
+    using Value = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+  public:
+    struct State {
+        std::atomic<bool> ready = false;
+        std::optional<Value> value;
+        std::exception_ptr exception;
+    };
+
+    TaskFuture() = default;
+    explicit TaskFuture(std::shared_ptr<State> state)
+        : state_(std::move(state))
+    {}
+
+    bool valid() const { return state_ != nullptr; }
+    bool is_ready() const { return state_->ready.load(std::memory_order_acquire); }
+
+    T get()
+    {
+#ifndef NO_MULTITHREADING
+        WorkStealingScheduler::get().help_until([this] { return is_ready(); });
+#endif
+        auto state = std::move(state_);
+        if (state->exception) {
+            std::rethrow_exception(state->exception);
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(*state->value);
+        }
+    }
+
+  private:
+    std::shared_ptr<State> state_;
+};
+
+/**
+ * @brief Run `func` asynchronously on the global work-stealing scheduler.
+ * @details Tasks may themselves spawn tasks, call parallel_for or wait on other futures, so a computation can be
+ * expressed as a dependency graph rather than a sequence of fork-join barriers. Without multithreading the task runs
+ * immediately on the calling thread.
+ */
+template <typename Func> auto spawn_task(Func&& func) -> TaskFuture<std::invoke_result_t<std::decay_t<Func>&>>
+{
+    using Result = std::invoke_result_t<std::decay_t<Func>&>;
+    using State = typename TaskFuture<Result>::State;
+
+    auto state = std::make_shared<State>();
+    auto task = [state, func = std::forward<Func>(func)]() mutable {
+#ifndef BB_NO_EXCEPTIONS
+        try {
+#endif
+            if constexpr (std::is_void_v<Result>) {
+                func();
+                state->value.emplace();
+            } else {
+                state->value.emplace(func());
+            }
+#ifndef BB_NO_EXCEPTIONS
+        } catch (...) {
+            state->exception = std::current_exception();
+        }
+#endif
+        state->ready.store(true, std::memory_order_release);
+    };
+#ifdef NO_MULTITHREADING
+    task();
+#else
+    WorkStealingScheduler::get().submit(std::move(task));
+#endif
+    return TaskFuture<Result>(std::move(state));
+}
+
+} // namespace bb
@@ -1,16 +1,20 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -45,6 +49,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using AppendCompletionCallback = std::function<void(TypedResponse<AddDataResponse>&)>;
     using MetaDataCallback = std::function<void(TypedResponse<TreeMetaResponse>&)>;
     using HashPathCallback = std::function<void(TypedResponse<GetSiblingPathResponse>&)>;
+    using HashPathsCallback = std::function<void(TypedResponse<GetSiblingPathsResponse>&)>;
     using FindLeafCallback = std::function<void(TypedResponse<FindLeafIndexResponse>&)>;
     using GetLeafCallback = std::function<void(TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(TypedResponse<CommitResponse>&)>;
@@ -102,6 +107,30 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                           const HashPathCallback& on_completion,
                           bool includeUncommitted) const;
 
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root
+     * Paths are walked together, a node shared by several of them is only read once
+     * @param indices The indices at which to read the sibling paths, in any order and possibly repeated
+     * @param on_completion Callback to be called on completion, the paths are in the order of indices
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root
+     * Paths are walked together, a node shared by several of them is only read once
+     * @param indices The indices at which to read the sibling paths, in any order and possibly repeated
+     * @param blockNumber The block number of the tree to use as a reference
+     * @param on_completion Callback to be called on completion, the paths are in the order of indices
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const block_number_t& blockNumber,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
     /**
      * @brief Get the subtree sibling path object
      *
@@ -255,6 +284,18 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                                                           const RequestContext& requestContext,
                                                           ReadTransaction& tx) const;
 
+    std::vector<fr_sibling_path> get_sibling_paths_internal(const std::vector<index_t>& indices,
+                                                            const RequestContext& requestContext,
+                                                            ReadTransaction& tx) const;
+
+    void fill_sibling_paths(const fr& hash,
+                            uint32_t level,
+                            std::span<const size_t> requests,
+                            const std::vector<index_t>& indices,
+                            std::vector<fr_sibling_path>& paths,
+                            const RequestContext& requestContext,
+                            ReadTransaction& tx) const;
+
     std::optional<fr> find_leaf_hash(const index_t& leaf_index,
                                      const RequestContext& requestContext,
                                      ReadTransaction& tx,
@@ -265,6 +306,11 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    void hash_level(std::span<const fr> children, std::span<fr> parents) const;
+
+    // Returns the hashes of the empty subtrees at each level of a tree of the given depth
+    static const std::vector<fr>& get_zero_hashes(uint32_t depth);
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -272,6 +318,28 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     std::shared_ptr<ThreadPool> workers_;
 };
 
+template <typename Store, typename HashingPolicy>
+const std::vector<fr>& ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_zero_hashes(uint32_t depth)
+{
+    // A tree (and each of its forks) would otherwise hash its way up from an empty leaf every time it is constructed.
+    // The results only depend on the depth, so they are computed once and shared.
+    static std::mutex mutex;
+    static std::unordered_map<uint32_t, std::vector<fr>> zero_hashes_by_depth;
+    std::lock_guard lock(mutex);
+    auto [it, inserted] = zero_hashes_by_depth.try_emplace(depth, depth + 1);
+    if (inserted) {
+        std::vector<fr>& zero_hashes = it->second;
+        auto current = HashingPolicy::zero_hash();
+        for (size_t i = depth; i > 0; --i) {
+            zero_hashes[i] = current;
+            current = HashingPolicy::hash_pair(current, current);
+        }
+        zero_hashes[0] = current;
+    }
+    // References to the elements of an unordered_map remain valid as it grows
+    return it->second;
+}
+
 template <typename Store, typename HashingPolicy>
 ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnlyTree(
     std::unique_ptr<Store> store,
@@ -285,17 +353,7 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnly
     // start by reading the meta data from the backing store
     store_->get_meta(meta);
     depth_ = meta.depth;
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = HashingPolicy::zero_hash();
-    for (size_t i = depth_; i > 0; --i) {
-        // std::cout << "Zero hash at " << i << " : " << current << std::endl;
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
-    // std::cout << "Zero root: " << current << std::endl;
+    zero_hashes_ = get_zero_hashes(depth_);
 
     max_size_ = numeric::pow64(2, depth_);
     // if root is non-zero it means the tree has already been initialized
@@ -304,7 +362,7 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnly
     }
 
     if (initial_values.empty()) {
-        meta.initialRoot = meta.root = current;
+        meta.initialRoot = meta.root = zero_hashes_[0];
         meta.initialSize = meta.size = 0;
     } else {
         Signal signal(1);
@@ -414,6 +472,55 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path(cons
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                RequestContext requestContext;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = store_->get_current_root(*tx, includeUncommitted);
+                response.inner.paths = get_sibling_paths_internal(indices, requestContext, *tx);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const block_number_t& blockNumber,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                if (blockNumber == 0) {
+                    throw std::runtime_error("Unable to get sibling paths at block 0");
+                }
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                BlockPayload blockData;
+                if (!store_->get_block_data(blockNumber, blockData, *tx)) {
+                    throw std::runtime_error(
+                        format("Unable to get sibling paths at block ", blockNumber, ", failed to get block data."));
+                }
+
+                RequestContext requestContext;
+                requestContext.blockNumber = blockNumber;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = blockData.root;
+                response.inner.paths = get_sibling_paths_internal(indices, requestContext, *tx);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_block_numbers(
     const std::vector<index_t>& indices, const GetBlockForIndexCallback& on_completion) const
@@ -526,6 +633,76 @@ fr_sibling_path ContentAddressedAppendOnlyTree<Store, HashingPolicy>::optional_s
     return path;
 }
 
+template <typename Store, typename HashingPolicy>
+std::vector<fr_sibling_path> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(
+    const std::vector<index_t>& indices, const RequestContext& requestContext, ReadTransaction& tx) const
+{
+    // Sorting the requests by index means that the requests below any node form a contiguous range
+    std::vector<size_t> requests(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        if (indices[i] >= max_size_) {
+            throw std::runtime_error(format("Unable to get sibling path for index ", indices[i], ", out of range"));
+        }
+        requests[i] = i;
+    }
+    std::sort(requests.begin(), requests.end(), [&](size_t lhs, size_t rhs) { return indices[lhs] < indices[rhs]; });
+
+    // Start from the sibling path of an empty tree, only the non-empty siblings need to be written
+    fr_sibling_path empty_path(depth_);
+    for (uint32_t i = 0; i < depth_; ++i) {
+        empty_path[i] = zero_hashes_[depth_ - i];
+    }
+    std::vector<fr_sibling_path> paths(indices.size(), empty_path);
+    fill_sibling_paths(requestContext.root, 0, requests, indices, paths, requestContext, tx);
+    return paths;
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::fill_sibling_paths(const fr& hash,
+                                                                              uint32_t level,
+                                                                              std::span<const size_t> requests,
+                                                                              const std::vector<index_t>& indices,
+                                                                              std::vector<fr_sibling_path>& paths,
+                                                                              const RequestContext& requestContext,
+                                                                              ReadTransaction& tx) const
+{
+    if (requests.empty() || level == depth_) {
+        return;
+    }
+    NodePayload nodePayload;
+    if (!store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted)) {
+        // An empty subtree, the paths already hold the zero hashes below here
+        return;
+    }
+
+    // The requests going left come first
+    const index_t mask = index_t(1) << (depth_ - 1 - level);
+    auto first_right = std::partition_point(
+        requests.begin(), requests.end(), [&](size_t request) { return (indices[request] & mask) == 0; });
+    std::span<const size_t> left_requests(requests.begin(), first_right);
+    std::span<const size_t> right_requests(first_right, requests.end());
+
+    const size_t path_index = depth_ - 1 - level;
+    if (nodePayload.right.has_value()) {
+        for (size_t request : left_requests) {
+            paths[request][path_index] = nodePayload.right.value();
+        }
+    }
+    if (nodePayload.left.has_value()) {
+        for (size_t request : right_requests) {
+            paths[request][path_index] = nodePayload.left.value();
+        }
+    }
+
+    // A missing child is an empty subtree, all the siblings below it are zero hashes
+    if (nodePayload.left.has_value()) {
+        fill_sibling_paths(nodePayload.left.value(), level + 1, left_requests, indices, paths, requestContext, tx);
+    }
+    if (nodePayload.right.has_value()) {
+        fill_sibling_paths(nodePayload.right.value(), level + 1, right_requests, indices, paths, requestContext, tx);
+    }
+}
+
 template <typename Store, typename HashingPolicy>
 std::optional<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_hash(
     const index_t& leaf_index,
@@ -1000,12 +1177,7 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     }
 
     // Add the values at the leaf nodes of the tree
-    for (uint32_t i = 0; i < number_to_insert; ++i) {
-        // write_node(level, index + i, hashes_local[i]);
-        // std::cout << "Writing leaf hash: " << hashes_local[i] << " level " << level << std::endl;
-        store_->put_node_by_hash(hashes_local[i], { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
-        store_->put_cached_node_by_index(level, i + index, hashes_local[i]);
-    }
+    store_->put_nodes_at_level(level, index, hashes_local);
 
     // If we have been told to add these leaves to the index then do so now
     if (update_index) {
@@ -1019,22 +1191,19 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them, a level at a time. The children are kept until their parents have
+    // been written, so the level is hashed into a second buffer rather than in place
+    std::vector<fr> parents;
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
         // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
-        }
+        parents.resize(number_to_insert);
+        std::span<const fr> children(hashes_local.data(), static_cast<size_t>(number_to_insert) * 2);
+        hash_level(children, parents);
+        store_->put_nodes_at_level(level, index, parents, children);
+        std::swap(hashes_local, parents);
     }
 
     fr new_hash = hashes_local[0];
@@ -1080,4 +1249,27 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     store_->put_meta(meta);
 }
 
+/**
+ * @brief Computes parents[i] = hash(children[2i], children[2i + 1]) for a whole level of the tree
+ * @details The pairs are split into chunks that are hashed in parallel on the tree's workers. This is usually called
+ * from a job that is itself running on those workers, which ThreadPool::parallel_for allows.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_level(std::span<const fr> children,
+                                                                     std::span<fr> parents) const
+{
+    // Enough pairs per chunk to amortise the scheduling, which costs about as much as a couple of hashes
+    constexpr size_t MIN_PAIRS_PER_CHUNK = 32;
+
+    const size_t num_pairs = parents.size();
+    const size_t num_chunks =
+        std::min(std::max<size_t>(1, num_pairs / MIN_PAIRS_PER_CHUNK), workers_->num_threads() + 1);
+    const size_t chunk_size = (num_pairs + num_chunks - 1) / num_chunks;
+    workers_->parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t begin = std::min(num_pairs, chunk * chunk_size);
+        const size_t end = std::min(num_pairs, (chunk + 1) * chunk_size);
+        HashingPolicy::hash_pairs(children.subspan(2 * begin, 2 * (end - begin)), parents.subspan(begin, end - begin));
+    });
+}
+
 } // namespace bb::crypto::merkle_tree
@@ -140,6 +140,29 @@ void check_historic_sibling_path(TreeType& tree,
     signal.wait_for_level();
 }
 
+void check_sibling_paths(TreeType& tree,
+                         const std::vector<index_t>& indices,
+                         const std::vector<fr_sibling_path>& expected_sibling_paths,
+                         bool includeUncommitted = true,
+                         std::optional<block_number_t> blockNumber = std::nullopt,
+                         bool expected_success = true)
+{
+    Signal signal;
+    auto completion = [&](const TypedResponse<GetSiblingPathsResponse>& response) -> void {
+        EXPECT_EQ(response.success, expected_success);
+        if (response.success) {
+            EXPECT_EQ(response.inner.paths, expected_sibling_paths);
+        }
+        signal.signal_level();
+    };
+    if (blockNumber.has_value()) {
+        tree.get_sibling_paths(indices, blockNumber.value(), completion, includeUncommitted);
+    } else {
+        tree.get_sibling_paths(indices, completion, includeUncommitted);
+    }
+    signal.wait_for_level();
+}
+
 void commit_tree(TreeType& tree, bool expected_success = true)
 {
     Signal signal;
@@ -898,6 +921,58 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_historic_siblin
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_multiple_sibling_paths)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Unsorted, repeated and beyond the end of the tree
+    std::vector<index_t> indices = { 9, 0, 3, 9, 17, 1, 2, 1023, 8 };
+    auto expected_paths = [&]() {
+        std::vector<fr_sibling_path> paths;
+        for (index_t index : indices) {
+            paths.push_back(memdb.get_sibling_path(index));
+        }
+        return paths;
+    };
+
+    check_sibling_paths(tree, indices, expected_paths());
+    check_sibling_paths(tree, {}, {});
+
+    std::vector<fr> values;
+    for (size_t i = 0; i < 10; ++i) {
+        memdb.update_element(i, VALUES[i]);
+        values.push_back(VALUES[i]);
+    }
+    add_values(tree, values);
+    std::vector<fr_sibling_path> block_one_paths = expected_paths();
+    check_sibling_paths(tree, indices, block_one_paths);
+    commit_tree(tree);
+
+    values.clear();
+    for (size_t i = 10; i < 20; ++i) {
+        memdb.update_element(i, VALUES[i]);
+        values.push_back(VALUES[i]);
+    }
+    add_values(tree, values);
+    check_sibling_paths(tree, indices, expected_paths());
+    check_sibling_paths(tree, indices, block_one_paths, false);
+    check_sibling_paths(tree, indices, block_one_paths, true, 1);
+
+    // Every path agrees with the single path retrieval
+    for (size_t i = 0; i < indices.size(); ++i) {
+        check_sibling_path(tree, indices[i], expected_paths()[i]);
+    }
+
+    check_sibling_paths(tree, { 0, 1024 }, {}, true, std::nullopt, false);
+    check_sibling_paths(tree, indices, {}, true, 2, false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, retrieves_historic_leaves)
 {
     constexpr size_t depth = 10;
@@ -8,6 +8,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -17,6 +18,13 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    static void hash_pairs(std::span<const fr> children, std::span<fr> parents)
+    {
+        for (size_t i = 0; i < parents.size(); ++i) {
+            parents[i] = hash_pair(children[2 * i], children[2 * i + 1]);
+        }
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -26,7 +34,15 @@ struct Poseidon2HashPolicy {
         return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
+    static fr hash_pair(const fr& lhs, const fr& rhs)
+    {
+        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pair(lhs, rhs);
+    }
+
+    static void hash_pairs(std::span<const fr> children, std::span<fr> parents)
+    {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(children, parents);
+    }
 
     static fr zero_hash() { return fr::zero(); }
 };
@@ -286,15 +286,7 @@ ContentAddressedIndexedTree<Store, HashingPolicy>::ContentAddressedIndexedTree(
     if (prefilled_values.size() > initial_size) {
         throw std::runtime_error("Number of prefilled values can't be more than initial size");
     }
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = fr::zero();
-    for (uint32_t i = depth_; i > 0; --i) {
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
+    // The zero hashes have been set up by the append only tree, empty leaves are zero for both
 
     TreeMeta meta;
     store_->get_meta(meta);
@@ -951,6 +943,21 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
                                                     " max size: ",
                                                     max_size_));
                 }
+
+                // The values are unique and in descending order, so none of the leaves added below can be the low
+                // leaf of a value that follows it. This allows the low leaves of all values to be found up front, in
+                // one pass over the uncommitted leaf keys.
+                std::vector<fr> keys_to_search;
+                keys_to_search.reserve(values.size());
+                for (const auto& value_pair : values) {
+                    if (!value_pair.first.is_empty()) {
+                        keys_to_search.emplace_back(value_pair.first.get_key());
+                    }
+                }
+                std::vector<std::pair<bool, index_t>> low_values =
+                    store_->find_low_values(keys_to_search, requestContext, *tx);
+                size_t next_low_value = 0;
+
                 for (size_t i = 0; i < values.size(); ++i) {
                     std::pair<LeafValueType, size_t>& value_pair = values[i];
                     size_t index_into_appended_leaves = value_pair.second;
@@ -970,8 +977,7 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
                     bool is_already_present = false;
 
                     requestContext.root = store_->get_current_root(*tx, true);
-                    std::tie(is_already_present, low_leaf_index) =
-                        store_->find_low_value(value_pair.first.get_key(), requestContext, *tx);
+                    std::tie(is_already_present, low_leaf_index) = low_values[next_low_value++];
                     // std::cout << "Found low leaf index " << low_leaf_index << std::endl;
 
                     // Try and retrieve the leaf pre-image from the cache first.
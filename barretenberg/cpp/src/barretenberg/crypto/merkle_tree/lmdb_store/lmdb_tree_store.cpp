@@ -48,6 +48,61 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
     return value_cmp<uint64_t>(a, b);
 }
 
+namespace payload_encoding {
+
+void encode(const BlockPayload& block, std::vector<uint8_t>& buffer)
+{
+    buffer.resize(BLOCK_PAYLOAD_SIZE);
+    uint8_t* dst = write_header(buffer.data());
+    write_field(write_field(write_field(dst, block.size), block.blockNumber), block.root);
+}
+
+bool decode(const MDB_val& value, BlockPayload& block)
+{
+    const uint8_t* src = fields_of(value, BLOCK_PAYLOAD_SIZE, "block payload");
+    if (src == nullptr) {
+        return false;
+    }
+    read_field(read_field(read_field(src, block.size), block.blockNumber), block.root);
+    return true;
+}
+
+void encode(const NodePayload& node, std::vector<uint8_t>& buffer)
+{
+    // The children are zero filled when absent, the buffer is fully overwritten otherwise
+    buffer.assign(NODE_PAYLOAD_SIZE, 0);
+    uint8_t* dst = write_header(buffer.data());
+    *dst++ = static_cast<uint8_t>((node.left.has_value() ? 1 : 0) | (node.right.has_value() ? 2 : 0));
+    dst = write_field(dst, node.ref);
+    if (node.left.has_value()) {
+        write_field(dst, node.left.value());
+    }
+    if (node.right.has_value()) {
+        write_field(dst + FR_SIZE, node.right.value());
+    }
+}
+
+bool decode(const MDB_val& value, NodePayload& node)
+{
+    const uint8_t* src = fields_of(value, NODE_PAYLOAD_SIZE, "node payload");
+    if (src == nullptr) {
+        return false;
+    }
+    const uint8_t flags = *src++;
+    src = read_field(src, node.ref);
+    node.left.reset();
+    node.right.reset();
+    if ((flags & 1) != 0) {
+        read_field(src, node.left.emplace());
+    }
+    if ((flags & 2) != 0) {
+        read_field(src + FR_SIZE, node.right.emplace());
+    }
+    return true;
+}
+
+} // namespace payload_encoding
+
 LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
     : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 5)
     , _name(std::move(name))
@@ -108,9 +163,8 @@ void LMDBTreeStore::write_block_data(const block_number_t& blockNumber,
                                      const BlockPayload& blockData,
                                      LMDBTreeStore::WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, blockData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    payload_encoding::encode(blockData, encoded);
     BlockMetaKeyType key(blockNumber);
     tx.put_value<BlockMetaKeyType>(key, encoded, *_blockDatabase);
 }
@@ -126,10 +180,10 @@ bool LMDBTreeStore::read_block_data(const block_number_t& blockNumber,
                                     LMDBTreeStore::ReadTransaction& tx)
 {
     BlockMetaKeyType key(blockNumber);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.get_value<BlockMetaKeyType>(key, data, *_blockDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(blockData);
+        payload_encoding::decode_or_unpack(data, blockData);
     }
     return success;
 }
@@ -308,20 +362,13 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
-    FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
-    }
-    return success;
+    return get_node_data(nodeHash, nodeData, tx);
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    payload_encoding::encode(nodeData, encoded);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
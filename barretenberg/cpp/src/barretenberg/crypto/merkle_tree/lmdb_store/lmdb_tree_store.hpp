@@ -2,6 +2,7 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/payload_encoding.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -60,6 +61,32 @@ struct NodePayload {
     }
 };
 
+namespace payload_encoding {
+
+// Layout: header | size | blockNumber | root
+constexpr size_t BLOCK_PAYLOAD_SIZE = HEADER_SIZE + 2 * U64_SIZE + FR_SIZE;
+// Layout: header | presence flags | ref | left | right. Absent children are written as zero.
+constexpr size_t NODE_PAYLOAD_SIZE = HEADER_SIZE + 1 + U64_SIZE + 2 * FR_SIZE;
+
+void encode(const BlockPayload& block, std::vector<uint8_t>& buffer);
+bool decode(const MDB_val& value, BlockPayload& block);
+
+void encode(const NodePayload& node, std::vector<uint8_t>& buffer);
+bool decode(const MDB_val& value, NodePayload& node);
+
+/**
+ * Decodes a value in the fixed layout, falling back to msgpack for values written before it was introduced. Such values
+ * are migrated lazily, they are rewritten in the fixed layout the next time they are written.
+ */
+template <typename PayloadType> void decode_or_unpack(const MDB_val& value, PayloadType& payload)
+{
+    if (!decode(value, payload)) {
+        msgpack::unpack(static_cast<const char*>(value.mv_data), value.mv_size).get().convert(payload);
+    }
+}
+
+} // namespace payload_encoding
+
 struct BlockIndexPayload {
     std::vector<block_number_t> blockNumbers;
 
@@ -253,10 +280,10 @@ template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+        payload_encoding::decode_or_unpack(data, leafData);
     }
     return success;
 }
@@ -264,9 +291,8 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, leafData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    payload_encoding::encode(leafData, encoded);
     FrKeyType key(leafHash);
     tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
 }
@@ -274,10 +300,10 @@ void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafD
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        payload_encoding::decode_or_unpack(data, nodeData);
     }
     return success;
 }
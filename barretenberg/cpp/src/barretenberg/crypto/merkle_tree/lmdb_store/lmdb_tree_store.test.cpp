@@ -300,6 +300,43 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+template <typename PayloadType> void check_payload_encodings(const PayloadType& payload)
+{
+    // Current fixed layout
+    std::vector<uint8_t> encoded;
+    payload_encoding::encode(payload, encoded);
+    MDB_val value{ encoded.size(), encoded.data() };
+    PayloadType readBack;
+    EXPECT_TRUE(payload_encoding::decode(value, readBack));
+    EXPECT_EQ(readBack, payload);
+
+    // Values written by earlier versions are msgpack encoded
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, payload);
+    MDB_val legacyValue{ buffer.size(), buffer.data() };
+    PayloadType legacyReadBack;
+    EXPECT_FALSE(payload_encoding::decode(legacyValue, legacyReadBack));
+    payload_encoding::decode_or_unpack(legacyValue, legacyReadBack);
+    EXPECT_EQ(legacyReadBack, payload);
+
+    // A fixed layout value of the wrong size is rejected rather than misread
+    encoded.pop_back();
+    MDB_val truncated{ encoded.size(), encoded.data() };
+    EXPECT_THROW(payload_encoding::decode(truncated, readBack), std::runtime_error);
+}
+
+TEST_F(LMDBTreeStoreTest, can_encode_and_decode_payloads)
+{
+    check_payload_encodings(BlockPayload{ .size = 45, .blockNumber = 3, .root = VALUES[0] });
+    check_payload_encodings(NodePayload{ .left = VALUES[1], .right = VALUES[2], .ref = 7 });
+    check_payload_encodings(NodePayload{ .left = std::nullopt, .right = VALUES[3], .ref = 1 });
+    check_payload_encodings(NodePayload{ .left = std::nullopt, .right = std::nullopt, .ref = 0 });
+    check_payload_encodings(PublicDataLeafValue(VALUES[4], VALUES[5]));
+    check_payload_encodings(IndexedLeaf<NullifierLeafValue>(NullifierLeafValue(VALUES[6]), 12, VALUES[7]));
+    check_payload_encodings(
+        IndexedLeaf<PublicDataLeafValue>(PublicDataLeafValue(VALUES[8], VALUES[9]), 1ULL << 40, VALUES[0]));
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_retrieve_block_numbers_by_index)
 {
     struct BlockAndIndex {
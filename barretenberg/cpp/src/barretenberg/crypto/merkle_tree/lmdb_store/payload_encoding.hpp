@@ -0,0 +1,158 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "lmdb.h"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Fixed layout encoding of the values stored in the tree databases.
+ *
+ * Every value starts with FORMAT_TAG followed by a version byte. 0xc1 is a byte that msgpack never emits, so these
+ * values can't be confused with the msgpack encoding written by earlier versions, which is still accepted on read.
+ * The fields follow without any framing: field elements as their in-memory (Montgomery form) limbs and integers as
+ * uint64, both little endian. Decoding is therefore a handful of copies straight out of the memory map.
+ */
+namespace bb::crypto::merkle_tree::payload_encoding {
+
+static_assert(std::endian::native == std::endian::little, "The tree databases are stored little endian");
+
+constexpr uint8_t FORMAT_TAG = 0xc1;
+constexpr uint8_t FORMAT_VERSION = 1;
+constexpr size_t HEADER_SIZE = 2;
+constexpr size_t FR_SIZE = sizeof(fr);
+constexpr size_t U64_SIZE = sizeof(uint64_t);
+
+inline uint8_t* write_header(uint8_t* dst)
+{
+    dst[0] = FORMAT_TAG;
+    dst[1] = FORMAT_VERSION;
+    return dst + HEADER_SIZE;
+}
+
+inline uint8_t* write_field(uint8_t* dst, const fr& value)
+{
+    std::memcpy(dst, value.data, FR_SIZE);
+    return dst + FR_SIZE;
+}
+
+inline uint8_t* write_field(uint8_t* dst, const uint64_t& value)
+{
+    std::memcpy(dst, &value, U64_SIZE);
+    return dst + U64_SIZE;
+}
+
+inline const uint8_t* read_field(const uint8_t* src, fr& value)
+{
+    std::memcpy(value.data, src, FR_SIZE);
+    return src + FR_SIZE;
+}
+
+inline const uint8_t* read_field(const uint8_t* src, uint64_t& value)
+{
+    std::memcpy(&value, src, U64_SIZE);
+    return src + U64_SIZE;
+}
+
+/**
+ * Returns a pointer to the fields of value if it is in the fixed layout, or nullptr if it is a legacy (msgpack) value.
+ * Throws if the value claims to be in the fixed layout but is of an unknown version or of the wrong size.
+ */
+inline const uint8_t* fields_of(const MDB_val& value, size_t encodedSize, const char* payloadName)
+{
+    const auto* data = static_cast<const uint8_t*>(value.mv_data);
+    if (value.mv_size == 0 || data[0] != FORMAT_TAG) {
+        return nullptr;
+    }
+    if (value.mv_size != encodedSize || data[1] != FORMAT_VERSION) {
+        throw std::runtime_error(format("Invalid encoding of ",
+                                        payloadName,
+                                        ", version: ",
+                                        value.mv_size > 1 ? static_cast<uint32_t>(data[1]) : 0U,
+                                        ", size: ",
+                                        value.mv_size));
+    }
+    return data + HEADER_SIZE;
+}
+
+template <typename LeafValueType> struct LeafValueLayout;
+
+// The leaves of append only trees
+template <> struct LeafValueLayout<fr> {
+    static constexpr size_t SIZE = FR_SIZE;
+
+    static uint8_t* write(uint8_t* dst, const fr& leaf) { return write_field(dst, leaf); }
+
+    static const uint8_t* read(const uint8_t* src, fr& leaf) { return read_field(src, leaf); }
+};
+
+template <> struct LeafValueLayout<NullifierLeafValue> {
+    static constexpr size_t SIZE = FR_SIZE;
+
+    static uint8_t* write(uint8_t* dst, const NullifierLeafValue& leaf) { return write_field(dst, leaf.nullifier); }
+
+    static const uint8_t* read(const uint8_t* src, NullifierLeafValue& leaf) { return read_field(src, leaf.nullifier); }
+};
+
+template <> struct LeafValueLayout<PublicDataLeafValue> {
+    static constexpr size_t SIZE = 2 * FR_SIZE;
+
+    static uint8_t* write(uint8_t* dst, const PublicDataLeafValue& leaf)
+    {
+        return write_field(write_field(dst, leaf.slot), leaf.value);
+    }
+
+    static const uint8_t* read(const uint8_t* src, PublicDataLeafValue& leaf)
+    {
+        return read_field(read_field(src, leaf.slot), leaf.value);
+    }
+};
+
+// Layout: header | leaf value
+template <typename LeafValueType> constexpr size_t LEAF_VALUE_SIZE = HEADER_SIZE + LeafValueLayout<LeafValueType>::SIZE;
+
+template <typename LeafValueType> void encode(const LeafValueType& leaf, std::vector<uint8_t>& buffer)
+{
+    buffer.resize(LEAF_VALUE_SIZE<LeafValueType>);
+    LeafValueLayout<LeafValueType>::write(write_header(buffer.data()), leaf);
+}
+
+template <typename LeafValueType> bool decode(const MDB_val& value, LeafValueType& leaf)
+{
+    const uint8_t* src = fields_of(value, LEAF_VALUE_SIZE<LeafValueType>, "leaf value");
+    if (src == nullptr) {
+        return false;
+    }
+    LeafValueLayout<LeafValueType>::read(src, leaf);
+    return true;
+}
+
+// Layout: header | leaf value | nextIndex | nextKey
+template <typename LeafValueType>
+constexpr size_t INDEXED_LEAF_SIZE = HEADER_SIZE + LeafValueLayout<LeafValueType>::SIZE + U64_SIZE + FR_SIZE;
+
+template <typename LeafValueType> void encode(const IndexedLeaf<LeafValueType>& leaf, std::vector<uint8_t>& buffer)
+{
+    buffer.resize(INDEXED_LEAF_SIZE<LeafValueType>);
+    uint8_t* dst = LeafValueLayout<LeafValueType>::write(write_header(buffer.data()), leaf.leaf);
+    write_field(write_field(dst, leaf.nextIndex), leaf.nextKey);
+}
+
+template <typename LeafValueType> bool decode(const MDB_val& value, IndexedLeaf<LeafValueType>& leaf)
+{
+    const uint8_t* src = fields_of(value, INDEXED_LEAF_SIZE<LeafValueType>, "leaf preimage");
+    if (src == nullptr) {
+        return false;
+    }
+    src = LeafValueLayout<LeafValueType>::read(src, leaf.leaf);
+    read_field(read_field(src, leaf.nextIndex), leaf.nextKey);
+    return true;
+}
+
+} // namespace bb::crypto::merkle_tree::payload_encoding
@@ -17,7 +17,9 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -65,6 +67,14 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                             const RequestContext& requestContext,
                                             ReadTransaction& tx) const;
 
+    /**
+     * @brief Performs find_low_value for each of the given keys. The uncommitted leaves are searched under a single
+     * lock, and more cheaply if the keys are sorted.
+     */
+    std::vector<std::pair<bool, index_t>> find_low_values(std::span<const fr> new_leaf_keys,
+                                                          const RequestContext& requestContext,
+                                                          ReadTransaction& tx) const;
+
     /**
      * @brief Returns the leaf at the provided index, if one exists
      */
@@ -100,6 +110,15 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     void put_cached_node_by_index(uint32_t level, const index_t& index, const fr& data, bool overwriteIfPresent = true);
 
+    /**
+     * @brief Writes a contiguous run of nodes of one level, starting at the given index, under a single lock. Node i
+     * has children { children[2i], children[2i + 1] }, or none if children is empty (i.e. the nodes are leaves).
+     */
+    void put_nodes_at_level(uint32_t level,
+                            const index_t& startIndex,
+                            std::span<const fr> nodeHashes,
+                            std::span<const fr> children = {});
+
     /**
      * @brief Returns the data at the given node coordinates if available.
      */
@@ -198,7 +217,8 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
         std::optional<BlockPayload> initialised_from_block_;
     };
     ForkConstantData forkConstantData_;
-    mutable std::mutex mtx_;
+    // Reads of the cache take a shared lock, updates an exclusive one
+    mutable std::shared_mutex mtx_;
 
     PersistedStoreType::SharedPtr dataStore_;
 
@@ -362,10 +382,59 @@ std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_lo
     }
 
     // Accessing the cache from here under a lock
-    std::unique_lock lock(mtx_);
+    std::shared_lock lock(mtx_);
     return cache_.find_low_value(new_leaf_key, retrieved_value, db_index);
 }
 
+template <typename LeafValueType>
+std::vector<std::pair<bool, index_t>> ContentAddressedCachedTreeStore<LeafValueType>::find_low_values(
+    std::span<const fr> new_leaf_keys, const RequestContext& requestContext, ReadTransaction& tx) const
+{
+    std::vector<std::pair<bool, index_t>> results(new_leaf_keys.size());
+    std::vector<uint256_t> keys(new_leaf_keys.size());
+    std::vector<uint256_t> retrieved_values(new_leaf_keys.size());
+    std::vector<index_t> db_indices(new_leaf_keys.size());
+
+    // See find_low_value, the size limit is the same for all of the keys
+    std::optional<index_t> sizeLimit = constrain_tree_size_to_only_committed(requestContext, tx);
+    for (size_t i = 0; i < new_leaf_keys.size(); ++i) {
+        index_t committed = 0;
+        retrieved_values[i] = dataStore_->find_low_leaf(new_leaf_keys[i], committed, sizeLimit, tx);
+        keys[i] = uint256_t(new_leaf_keys[i]);
+        db_indices[i] = committed;
+        results[i] = std::make_pair(retrieved_values[i] == keys[i], committed);
+    }
+
+    if (!requestContext.includeUncommitted) {
+        return results;
+    }
+
+    // Only the keys that were not found in the db need to be searched for in the cache
+    std::vector<size_t> positions;
+    positions.reserve(new_leaf_keys.size());
+    for (size_t i = 0; i < new_leaf_keys.size(); ++i) {
+        if (!results[i].first) {
+            keys[positions.size()] = keys[i];
+            retrieved_values[positions.size()] = retrieved_values[i];
+            db_indices[positions.size()] = db_indices[i];
+            positions.push_back(i);
+        }
+    }
+    std::vector<std::pair<bool, index_t>> cached(positions.size());
+    {
+        // Accessing the cache under a lock
+        std::shared_lock lock(mtx_);
+        cache_.find_low_values(std::span<const uint256_t>(keys.data(), positions.size()),
+                               std::span<const uint256_t>(retrieved_values.data(), positions.size()),
+                               std::span<const index_t>(db_indices.data(), positions.size()),
+                               cached);
+    }
+    for (size_t i = 0; i < positions.size(); ++i) {
+        results[positions[i]] = cached[i];
+    }
+    return results;
+}
+
 template <typename LeafValueType>
 std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLeafValueType>
 ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_hash,
@@ -375,7 +444,7 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
     IndexedLeafValueType leafData;
     if (includeUncommitted) {
         // Accessing the cache here under a lock
-        std::unique_lock lock(mtx_);
+        std::shared_lock lock(mtx_);
         if (cache_.get_leaf_preimage_by_hash(leaf_hash, leafData)) {
             return leafData;
         }
@@ -400,7 +469,7 @@ std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLe
 ContentAddressedCachedTreeStore<LeafValueType>::get_cached_leaf_by_index(const index_t& index) const
 {
     // Accessing the cache under a lock
-    std::unique_lock lock(mtx_);
+    std::shared_lock lock(mtx_);
     IndexedLeafValueType leafPreImage;
     if (cache_.get_leaf_by_index(index, leafPreImage)) {
         return leafPreImage;
@@ -450,7 +519,7 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
 {
     if (requestContext.includeUncommitted) {
         // Accessing the cache under a lock
-        std::unique_lock lock(mtx_);
+        std::shared_lock lock(mtx_);
         std::optional<index_t> cached = cache_.get_leaf_key_index(preimage_to_key(leaf));
         if (cached.has_value()) {
             // The is a cached value for the leaf
@@ -498,7 +567,7 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
 {
     if (includeUncommitted) {
         // Accessing nodes_ under a lock
-        std::unique_lock lock(mtx_);
+        std::shared_lock lock(mtx_);
         if (cache_.get_node(nodeHash, payload)) {
             return true;
         }
@@ -523,13 +592,43 @@ void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_node_by_index(ui
     cache_.put_node_by_index(level, index, data);
 }
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::put_nodes_at_level(uint32_t level,
+                                                                        const index_t& startIndex,
+                                                                        std::span<const fr> nodeHashes,
+                                                                        std::span<const fr> children)
+{
+    const bool hasChildren = !children.empty();
+    if (hasChildren && children.size() != nodeHashes.size() * 2) {
+        throw std::runtime_error(format("Expected ",
+                                        nodeHashes.size() * 2,
+                                        " children for ",
+                                        nodeHashes.size(),
+                                        " nodes at level ",
+                                        level,
+                                        ", got ",
+                                        children.size()));
+    }
+    // Accessing nodes_ and the cache under a lock
+    std::unique_lock lock(mtx_);
+    for (size_t i = 0; i < nodeHashes.size(); ++i) {
+        NodePayload payload{ .ref = 1 };
+        if (hasChildren) {
+            payload.left = children[2 * i];
+            payload.right = children[2 * i + 1];
+        }
+        cache_.put_node(nodeHashes[i], payload);
+        cache_.put_node_by_index(level, startIndex + i, nodeHashes[i]);
+    }
+}
+
 template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(uint32_t level,
                                                                               const index_t& index,
                                                                               fr& data) const
 {
     // Accessing the cache under a lock
-    std::unique_lock lock(mtx_);
+    std::shared_lock lock(mtx_);
     std::optional<fr> cached = cache_.get_node_by_index(level, index);
     if (cached.has_value()) {
         data = cached.value();
@@ -560,7 +659,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::get_meta(TreeMeta& m,
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::get_meta(TreeMeta& m) const
 {
     // Accessing meta_ under a lock
-    std::unique_lock lock(mtx_);
+    std::shared_lock lock(mtx_);
     m = cache_.get_meta();
 }
 
@@ -618,11 +717,10 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
 {
-    const std::map<uint256_t, index_t>& indices = cache_.get_indices();
-    for (const auto& idx : indices) {
-        FrKeyType key = idx.first;
-        dataStore_->write_leaf_index(key, idx.second, tx);
-    }
+    cache_.get_indices().for_each([&](const uint256_t& leafKey, const index_t& index) {
+        FrKeyType key = leafKey;
+        dataStore_->write_leaf_index(key, index, tx);
+    });
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::commit_genesis_state()
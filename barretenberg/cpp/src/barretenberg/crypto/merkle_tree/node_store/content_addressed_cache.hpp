@@ -2,6 +2,8 @@
 #include "./tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/leaf_key_index.hpp"
+#include "barretenberg/common/utils.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
@@ -14,6 +16,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -49,6 +52,11 @@ template <typename LeafValueType> class ContentAddressedCache {
     std::pair<bool, index_t> find_low_value(const uint256_t& new_leaf_key,
                                             const uint256_t& retrieved_value,
                                             const index_t& db_index) const;
+    // Performs find_low_value for each of the given keys, which should be sorted for best performance
+    void find_low_values(std::span<const uint256_t> new_leaf_keys,
+                         std::span<const uint256_t> retrieved_values,
+                         std::span<const index_t> db_indices,
+                         std::span<std::pair<bool, index_t>> results) const;
 
     bool get_leaf_preimage_by_hash(const fr& leaf_hash, IndexedLeafValueType& leaf_pre_image) const;
     void put_leaf_preimage_by_hash(const fr& leaf_hash, const IndexedLeafValueType& leaf_pre_image);
@@ -68,18 +76,27 @@ template <typename LeafValueType> class ContentAddressedCache {
     std::optional<fr> get_node_by_index(uint32_t level, const index_t& index) const;
     void put_node_by_index(uint32_t level, const index_t& index, const fr& node);
 
-    const std::map<uint256_t, index_t>& get_indices() const { return indices_; }
+    const LeafKeyIndex& get_indices() const { return indices_; }
 
     bool is_equivalent_to(const ContentAddressedCache& other) const;
 
   private:
+    struct NodeLocation {
+        uint32_t level;
+        index_t index;
+
+        bool operator==(const NodeLocation& other) const = default;
+        size_t hash() const noexcept { return utils::hash_as_tuple(level, index); }
+    };
+
+    // A journal only records the changes made after its checkpoint, so creating one is constant time and does not
+    // allocate
     struct Journal {
         // Captures the tree's metadata at the time of checkpoint
         TreeMeta meta_;
         // Captures the cache's node hashes at the time of checkpoint. If the node does not exist in the cache, the
         // optional will == nullopt
-        // TODO (PhilWindle): Consider where a more optimal approach is a single unordered map, instead of 1 per level
-        std::vector<std::unordered_map<index_t, std::optional<fr>>> nodes_by_index_;
+        std::unordered_map<NodeLocation, std::optional<fr>> nodes_by_index_;
         // Captures the cache's leaf pre-images at the time of checkpoint. Again, if the leaf does not exist in the
         // cache, the optional will == nullopt
         std::unordered_map<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
@@ -88,7 +105,6 @@ template <typename LeafValueType> class ContentAddressedCache {
 
         Journal(TreeMeta meta)
             : meta_(std::move(meta))
-            , nodes_by_index_(meta_.depth + 1, std::unordered_map<index_t, std::optional<fr>>())
         {}
     };
     // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
@@ -98,7 +114,7 @@ template <typename LeafValueType> class ContentAddressedCache {
 
     // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
     // index in the tree
-    std::map<uint256_t, index_t> indices_;
+    LeafKeyIndex indices_;
 
     // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
     // commiting updates
@@ -111,6 +127,15 @@ template <typename LeafValueType> class ContentAddressedCache {
 
     // The currently active journals
     std::vector<Journal> journals_;
+
+    // Merges the entries of a journal into those of the previous journal, in time proportional to the smaller of the
+    // two. Where both have an entry, the previous journal's is kept, it captured the cache at an earlier point
+    template <typename Map> static void merge_journal_entries(Map& previous, Map& current);
+
+    static std::pair<bool, index_t> low_value_from_entry(const std::optional<LeafKeyIndex::Entry>& entry,
+                                                         const uint256_t& new_leaf_key,
+                                                         const uint256_t& retrieved_value,
+                                                         const index_t& db_index);
 };
 
 template <typename LeafValueType> ContentAddressedCache<LeafValueType>::ContentAddressedCache(uint32_t depth)
@@ -136,15 +161,13 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::rev
 
     Journal& journal = journals_.back();
 
-    for (uint32_t i = 0; i < journal.nodes_by_index_.size(); ++i) {
-        for (const auto& [index, optional_node_hash] : journal.nodes_by_index_[i]) {
-            // If the optional == nullopt then we remove it from the primary cache, it never existed before
-            if (!optional_node_hash.has_value()) {
-                nodes_by_index_[i].erase(index);
-            } else {
-                // The optional is not null, this means there is a vlue to be restored to the primary cache
-                nodes_by_index_[i][index] = optional_node_hash.value();
-            }
+    for (const auto& [location, optional_node_hash] : journal.nodes_by_index_) {
+        // If the optional == nullopt then we remove it from the primary cache, it never existed before
+        if (!optional_node_hash.has_value()) {
+            nodes_by_index_[location.level].erase(location.index);
+        } else {
+            // The optional is not null, this means there is a vlue to be restored to the primary cache
+            nodes_by_index_[location.level][location.index] = optional_node_hash.value();
         }
     }
 
@@ -188,29 +211,13 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
     Journal& current_journal = journals_.back();
     Journal& previous_journal = journals_[journals_.size() - 2];
 
-    for (uint32_t i = 0; i < current_journal.nodes_by_index_.size(); ++i) {
-        for (const auto& [index, optional_node_hash] : current_journal.nodes_by_index_[i]) {
-            // There is an entry in the current journal, if it does not exist in the previous journal then we need to
-            // add it If it does exist in the previous journal then that journal already captured a value from the
-            // primary cache that existed no later
-            auto previousIter = previous_journal.nodes_by_index_[i].find(index);
-            if (previousIter == previous_journal.nodes_by_index_[i].end()) {
-                previous_journal.nodes_by_index_[i][index] = optional_node_hash;
-            }
-        }
-    }
+    merge_journal_entries(previous_journal.nodes_by_index_, current_journal.nodes_by_index_);
+    merge_journal_entries(previous_journal.leaf_pre_image_by_index_, current_journal.leaf_pre_image_by_index_);
 
-    for (const auto& [index, optional_leaf] : current_journal.leaf_pre_image_by_index_) {
-        // There is an entry in the current journal, if it does not exist in the previous journal then we need to add it
-        // If it does exist in the previous journal then that journal already captured a value from the
-        // primary cache that existed no later
-        auto previousIter = previous_journal.leaf_pre_image_by_index_.find(index);
-        if (previousIter == previous_journal.leaf_pre_image_by_index_.end()) {
-            previous_journal.leaf_pre_image_by_index_[index] = optional_leaf;
-        }
+    // Add our newly appended leaf keys to those of the previous journal, the two sets of keys are disjoint
+    if (current_journal.new_leaf_keys_.size() > previous_journal.new_leaf_keys_.size()) {
+        std::swap(previous_journal.new_leaf_keys_, current_journal.new_leaf_keys_);
     }
-
-    // Add our newly appended leaf keys to those of the previous journal
     previous_journal.new_leaf_keys_.insert(previous_journal.new_leaf_keys_.end(),
                                            current_journal.new_leaf_keys_.cbegin(),
                                            current_journal.new_leaf_keys_.cend());
@@ -219,10 +226,25 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
     journals_.pop_back();
 }
 
+template <typename LeafValueType>
+template <typename Map>
+void ContentAddressedCache<LeafValueType>::merge_journal_entries(Map& previous, Map& current)
+{
+    if (current.size() > previous.size()) {
+        std::swap(previous, current);
+        for (auto& [key, value] : current) {
+            previous.insert_or_assign(key, std::move(value));
+        }
+        return;
+    }
+    // Moves across the entries that are not in the previous journal, without copying them
+    previous.merge(current);
+}
+
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::reset(uint32_t depth)
 {
     nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, index_t>();
+    indices_.clear();
     leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
     nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth + 1, std::unordered_map<index_t, fr>());
     leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
@@ -285,31 +307,47 @@ std::pair<bool, index_t> ContentAddressedCache<LeafValueType>::find_low_value(co
         return std::make_pair(new_leaf_key == retrieved_value, db_index);
     }
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_leaf_key);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
-    }
+    return low_value_from_entry(indices_.find_low(new_leaf_key), new_leaf_key, retrieved_value, db_index);
+}
 
-    if (it->first == new_leaf_key) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
+template <typename LeafValueType>
+void ContentAddressedCache<LeafValueType>::find_low_values(std::span<const uint256_t> new_leaf_keys,
+                                                           std::span<const uint256_t> retrieved_values,
+                                                           std::span<const index_t> db_indices,
+                                                           std::span<std::pair<bool, index_t>> results) const
+{
+    if (indices_.empty()) {
+        for (size_t i = 0; i < new_leaf_keys.size(); ++i) {
+            results[i] = std::make_pair(new_leaf_keys[i] == retrieved_values[i], db_indices[i]);
+        }
+        return;
     }
-    // the iterator points to the element immediately larger than the requested value
-    // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
-    // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
+    std::vector<std::optional<LeafKeyIndex::Entry>> entries(new_leaf_keys.size());
+    indices_.find_low(new_leaf_keys, entries);
+    for (size_t i = 0; i < new_leaf_keys.size(); ++i) {
+        results[i] = low_value_from_entry(entries[i], new_leaf_keys[i], retrieved_values[i], db_indices[i]);
+    }
+}
+
+template <typename LeafValueType>
+std::pair<bool, index_t> ContentAddressedCache<LeafValueType>::low_value_from_entry(
+    const std::optional<LeafKeyIndex::Entry>& entry,
+    const uint256_t& new_leaf_key,
+    const uint256_t& retrieved_value,
+    const index_t& db_index)
+{
+    if (!entry.has_value()) {
+        // No cached value at or below the requested value, return the db index
         return std::make_pair(false, db_index);
     }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    if (entry->key == new_leaf_key) {
+        // the value is already present in the cache
+        return std::make_pair(true, entry->index);
+    }
+    // The entry is the next lowest cached value. We need to return the highest value from
+    // 1. The next lowest cached value
+    // 2. The value retrieved from the db
+    return std::make_pair(false, entry->key > retrieved_value ? entry->index : db_index);
 }
 
 template <typename LeafValueType>
@@ -376,8 +414,8 @@ template <typename LeafValueType>
 void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t& index, const fr& leaf_key)
 {
     uint256_t key = uint256_t(leaf_key);
-    auto result = indices_.insert({ key, index });
-    if (result.second && !journals_.empty()) {
+    bool inserted = indices_.insert(key, index);
+    if (inserted && !journals_.empty()) {
         // The insertion took place, if we have a current journal then we need to add to the newly inserted leaf keys
         Journal& journal = journals_.back();
         journal.new_leaf_keys_.emplace_back(key);
@@ -387,11 +425,7 @@ void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t&
 template <typename LeafValueType>
 std::optional<index_t> ContentAddressedCache<LeafValueType>::get_leaf_key_index(const fr& leaf_key) const
 {
-    auto it = indices_.find(uint256_t(leaf_key));
-    if (it == indices_.end()) {
-        return std::nullopt;
-    }
-    return it->second;
+    return indices_.find(uint256_t(leaf_key));
 }
 
 template <typename LeafValueType>
@@ -434,14 +468,15 @@ void ContentAddressedCache<LeafValueType>::put_node_by_index(uint32_t level, con
     Journal& journal = journals_.back();
 
     // If there is no node at the given location then add a nullopt to the journal
+    NodeLocation location{ .level = level, .index = index };
     auto cacheIter = nodes_by_index_[level].find(index);
     if (cacheIter == nodes_by_index_[level].end()) {
-        journal.nodes_by_index_[level][index] = std::nullopt;
+        journal.nodes_by_index_[location] = std::nullopt;
     } else {
         // There is a node. If the journal does not have a node at this index then add it to the journal
-        auto journalIter = journal.nodes_by_index_[level].find(index);
-        if (journalIter == journal.nodes_by_index_[level].end()) {
-            journal.nodes_by_index_[level][index] = cacheIter->second;
+        auto journalIter = journal.nodes_by_index_.find(location);
+        if (journalIter == journal.nodes_by_index_.end()) {
+            journal.nodes_by_index_[location] = cacheIter->second;
         }
     }
     nodes_by_index_[level][index] = node;
@@ -459,6 +459,29 @@ TEST_F(ContentAddressedCacheTest, can_commit_through_multiple_levels)
     EXPECT_TRUE(cache_copy.is_equivalent_to(cache));
 }
 
+TEST_F(ContentAddressedCacheTest, can_commit_into_smaller_checkpoint)
+{
+    CacheType cache = create_cache(40);
+    add_to_cache(cache, 0, 1000, 10000, 100);
+    CacheType base_cache = cache;
+
+    // The outer checkpoint overwrites a few entries, the inner one many more, including the same ones
+    cache.checkpoint();
+    add_to_cache(cache, 0, 10, 100, 100);
+    CacheType outer_cache = cache;
+    cache.checkpoint();
+    add_to_cache(cache, 0, 2000, 20000, 100);
+    CacheType inner_cache = cache;
+
+    cache.commit();
+    EXPECT_TRUE(inner_cache.is_equivalent_to(cache));
+
+    // The values captured by the outer checkpoint must survive the commit
+    cache.revert();
+    EXPECT_TRUE(base_cache.is_equivalent_to(cache));
+    EXPECT_FALSE(outer_cache.is_equivalent_to(cache));
+}
+
 void test_reverts_remove_all_deeper_commits(uint64_t max_index, uint32_t depth, uint64_t num_levels)
 {
     CacheType cache = create_cache(depth);
@@ -0,0 +1,228 @@
+#pragma once
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief An ordered map from leaf key to leaf index, used to index the uncommitted leaves of a tree.
+ *
+ * @details The entries are kept in sorted runs (blocks) of at most MAX_BLOCK_SIZE entries. Every block has a fence key,
+ * the largest key it holds, and the fences are kept in their own contiguous array. A lookup is a binary search over
+ * the fences followed by a binary search over the keys of one block, both over contiguous memory, rather than a walk
+ * over the scattered nodes of a std::map. An insert or erase moves at most one block worth of entries, plus one fence
+ * when a block is split or removed.
+ *
+ * The structure is not synchronised. Const member functions only read, so any number of them may run concurrently as
+ * long as no non-const member function runs at the same time (see the reader-writer lock of the cached tree store).
+ */
+class LeafKeyIndex {
+  public:
+    struct Entry {
+        uint256_t key;
+        index_t index;
+
+        bool operator==(const Entry& other) const = default;
+    };
+
+    // Blocks are split in half once they grow beyond this size
+    static constexpr size_t MAX_BLOCK_SIZE = 256;
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    void clear()
+    {
+        blocks_.clear();
+        fences_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Adds the entry if the key is not yet present. Returns whether it was added, existing entries are kept.
+     */
+    bool insert(const uint256_t& key, const index_t& index)
+    {
+        if (blocks_.empty()) {
+            blocks_.emplace_back();
+            fences_.emplace_back(key);
+        }
+        // Keys beyond the last fence go to the last block
+        size_t block_index = std::min(find_block(key), blocks_.size() - 1);
+        Block& block = blocks_[block_index];
+        auto it = std::lower_bound(block.keys.begin(), block.keys.end(), key);
+        if (it != block.keys.end() && *it == key) {
+            return false;
+        }
+        auto offset = it - block.keys.begin();
+        block.keys.insert(it, key);
+        block.indices.insert(block.indices.begin() + offset, index);
+        fences_[block_index] = block.keys.back();
+        ++size_;
+
+        if (block.keys.size() > MAX_BLOCK_SIZE) {
+            split_block(block_index);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Removes the entry with the given key. Returns whether there was one.
+     */
+    bool erase(const uint256_t& key)
+    {
+        size_t block_index = find_block(key);
+        if (block_index == blocks_.size()) {
+            return false;
+        }
+        Block& block = blocks_[block_index];
+        auto it = std::lower_bound(block.keys.begin(), block.keys.end(), key);
+        if (it == block.keys.end() || *it != key) {
+            return false;
+        }
+        auto offset = it - block.keys.begin();
+        block.keys.erase(it);
+        block.indices.erase(block.indices.begin() + offset);
+        --size_;
+
+        if (block.keys.empty()) {
+            blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(block_index));
+            fences_.erase(fences_.begin() + static_cast<std::ptrdiff_t>(block_index));
+        } else {
+            fences_[block_index] = block.keys.back();
+        }
+        return true;
+    }
+
+    std::optional<index_t> find(const uint256_t& key) const
+    {
+        size_t block_index = find_block(key);
+        if (block_index == blocks_.size()) {
+            return std::nullopt;
+        }
+        const Block& block = blocks_[block_index];
+        auto it = std::lower_bound(block.keys.begin(), block.keys.end(), key);
+        if (it == block.keys.end() || *it != key) {
+            return std::nullopt;
+        }
+        return block.indices[static_cast<size_t>(it - block.keys.begin())];
+    }
+
+    /**
+     * @brief Returns the entry with the largest key that is less than or equal to the given key, if there is one.
+     */
+    std::optional<Entry> find_low(const uint256_t& key) const { return find_low_in(find_block(key), key); }
+
+    /**
+     * @brief Performs find_low for each of the given keys. When the keys are sorted (in either direction), consecutive
+     * keys tend to fall into the same block and the search over the fences is skipped for them.
+     */
+    void find_low(std::span<const uint256_t> keys, std::span<std::optional<Entry>> results) const
+    {
+        size_t block_index = blocks_.size();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            const uint256_t& key = keys[i];
+            // The block of the previous key is the block of this one if its key range covers it
+            bool same_block = block_index < blocks_.size() && key <= fences_[block_index] &&
+                              (block_index == 0 || key > fences_[block_index - 1]);
+            if (!same_block) {
+                block_index = find_block(key);
+            }
+            results[i] = find_low_in(block_index, key);
+        }
+    }
+
+    /**
+     * @brief Calls fn(key, index) for every entry, in ascending key order
+     */
+    template <typename Fn> void for_each(Fn&& fn) const
+    {
+        for (const Block& block : blocks_) {
+            for (size_t i = 0; i < block.keys.size(); ++i) {
+                fn(block.keys[i], block.indices[i]);
+            }
+        }
+    }
+
+    // Equal when holding the same entries, regardless of how they are split into blocks
+    bool operator==(const LeafKeyIndex& other) const
+    {
+        if (size_ != other.size_) {
+            return false;
+        }
+        std::vector<Entry> entries;
+        entries.reserve(size_);
+        for_each([&](const uint256_t& key, const index_t& index) { entries.push_back({ key, index }); });
+        size_t i = 0;
+        bool equal = true;
+        other.for_each([&](const uint256_t& key, const index_t& index) {
+            equal = equal && entries[i++] == Entry{ key, index };
+        });
+        return equal;
+    }
+
+  private:
+    struct Block {
+        std::vector<uint256_t> keys;
+        std::vector<index_t> indices;
+    };
+
+    // Returns the first block whose fence is not less than key, or blocks_.size() if key is beyond the last fence
+    size_t find_block(const uint256_t& key) const
+    {
+        return static_cast<size_t>(std::lower_bound(fences_.begin(), fences_.end(), key) - fences_.begin());
+    }
+
+    std::optional<Entry> find_low_in(size_t block_index, const uint256_t& key) const
+    {
+        if (blocks_.empty()) {
+            return std::nullopt;
+        }
+        if (block_index == blocks_.size()) {
+            // Every key is less than the requested key, the last entry is the low entry
+            const Block& last = blocks_.back();
+            return Entry{ last.keys.back(), last.indices.back() };
+        }
+        const Block& block = blocks_[block_index];
+        auto it = std::upper_bound(block.keys.begin(), block.keys.end(), key);
+        if (it != block.keys.begin()) {
+            size_t offset = static_cast<size_t>(it - block.keys.begin()) - 1;
+            return Entry{ block.keys[offset], block.indices[offset] };
+        }
+        // All of this block's keys are larger, the low entry is the last one of the previous block
+        if (block_index == 0) {
+            return std::nullopt;
+        }
+        const Block& previous = blocks_[block_index - 1];
+        return Entry{ previous.keys.back(), previous.indices.back() };
+    }
+
+    void split_block(size_t block_index)
+    {
+        Block& block = blocks_[block_index];
+        auto half = static_cast<std::ptrdiff_t>(block.keys.size() / 2);
+        Block upper;
+        upper.keys.assign(block.keys.begin() + half, block.keys.end());
+        upper.indices.assign(block.indices.begin() + half, block.indices.end());
+        block.keys.resize(static_cast<size_t>(half));
+        block.indices.resize(static_cast<size_t>(half));
+        fences_[block_index] = block.keys.back();
+
+        auto position = static_cast<std::ptrdiff_t>(block_index) + 1;
+        fences_.insert(fences_.begin() + position, upper.keys.back());
+        blocks_.insert(blocks_.begin() + position, std::move(upper));
+    }
+
+    std::vector<Block> blocks_;
+    // fences_[i] is the largest key of blocks_[i]
+    std::vector<uint256_t> fences_;
+    size_t size_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
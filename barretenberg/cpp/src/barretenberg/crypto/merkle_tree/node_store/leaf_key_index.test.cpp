@@ -0,0 +1,119 @@
+#include "barretenberg/crypto/merkle_tree/node_store/leaf_key_index.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+std::optional<LeafKeyIndex::Entry> map_find_low(const std::map<uint256_t, index_t>& map, const uint256_t& key)
+{
+    auto it = map.upper_bound(key);
+    if (it == map.begin()) {
+        return std::nullopt;
+    }
+    --it;
+    return LeafKeyIndex::Entry{ it->first, it->second };
+}
+
+void check_against_map(const LeafKeyIndex& index, const std::map<uint256_t, index_t>& map)
+{
+    EXPECT_EQ(index.size(), map.size());
+    using Entries = std::vector<std::pair<uint256_t, index_t>>;
+    Entries entries;
+    index.for_each([&](const uint256_t& key, const index_t& value) { entries.emplace_back(key, value); });
+    EXPECT_EQ(entries, Entries(map.begin(), map.end()));
+}
+} // namespace
+
+TEST(LeafKeyIndexTest, can_find_low_entries)
+{
+    LeafKeyIndex index;
+    EXPECT_TRUE(index.empty());
+    EXPECT_FALSE(index.find_low(10).has_value());
+
+    EXPECT_TRUE(index.insert(20, 2));
+    EXPECT_TRUE(index.insert(10, 1));
+    EXPECT_TRUE(index.insert(30, 3));
+    // Existing entries are not overwritten
+    EXPECT_FALSE(index.insert(20, 5));
+    EXPECT_EQ(index.find(20), 2);
+    EXPECT_FALSE(index.find(25).has_value());
+
+    EXPECT_FALSE(index.find_low(9).has_value());
+    EXPECT_EQ(index.find_low(10), (LeafKeyIndex::Entry{ 10, 1 }));
+    EXPECT_EQ(index.find_low(29), (LeafKeyIndex::Entry{ 20, 2 }));
+    EXPECT_EQ(index.find_low(100), (LeafKeyIndex::Entry{ 30, 3 }));
+
+    EXPECT_TRUE(index.erase(20));
+    EXPECT_FALSE(index.erase(20));
+    EXPECT_EQ(index.find_low(29), (LeafKeyIndex::Entry{ 10, 1 }));
+    EXPECT_EQ(index.size(), 2);
+}
+
+TEST(LeafKeyIndexTest, matches_ordered_map)
+{
+    LeafKeyIndex index;
+    std::map<uint256_t, index_t> map;
+    // Enough entries for many blocks to be split and removed again. Keys are drawn from a small range so that inserts
+    // hit existing keys and erases hit present keys.
+    constexpr uint64_t num_operations = 20000;
+    constexpr uint64_t key_range = 4000;
+    for (uint64_t i = 0; i < num_operations; i++) {
+        uint256_t key = engine.get_random_uint64() % key_range;
+        if (engine.get_random_uint8() % 3 == 0) {
+            EXPECT_EQ(index.erase(key), map.erase(key) == 1);
+        } else {
+            EXPECT_EQ(index.insert(key, i), map.insert({ key, i }).second);
+        }
+        uint256_t probe = engine.get_random_uint64() % (key_range + 10);
+        auto it = map.find(probe);
+        EXPECT_EQ(index.find(probe), it == map.end() ? std::nullopt : std::make_optional(it->second));
+        EXPECT_EQ(index.find_low(probe), map_find_low(map, probe));
+    }
+    check_against_map(index, map);
+
+    // Descending keys, as used when generating the insertions of an indexed tree, and ascending keys
+    std::vector<uint256_t> keys;
+    for (uint64_t key = key_range + 10; key > 0; key--) {
+        keys.emplace_back(key);
+    }
+    std::vector<std::optional<LeafKeyIndex::Entry>> results(keys.size());
+    index.find_low(keys, results);
+    for (size_t i = 0; i < keys.size(); i++) {
+        EXPECT_EQ(results[i], map_find_low(map, keys[i]));
+    }
+    std::reverse(keys.begin(), keys.end());
+    index.find_low(keys, results);
+    for (size_t i = 0; i < keys.size(); i++) {
+        EXPECT_EQ(results[i], map_find_low(map, keys[i]));
+    }
+}
+
+TEST(LeafKeyIndexTest, equality_does_not_depend_on_blocks)
+{
+    LeafKeyIndex ascending;
+    LeafKeyIndex descending;
+    constexpr uint64_t num_entries = LeafKeyIndex::MAX_BLOCK_SIZE * 5;
+    for (uint64_t i = 0; i < num_entries; i++) {
+        ascending.insert(i, i);
+        descending.insert(num_entries - i - 1, num_entries - i - 1);
+    }
+    EXPECT_EQ(ascending, descending);
+
+    descending.erase(7);
+    EXPECT_NE(ascending, descending);
+    descending.insert(7, 8);
+    EXPECT_NE(ascending, descending);
+
+    ascending.clear();
+    EXPECT_TRUE(ascending.empty());
+    EXPECT_FALSE(ascending.find_low(num_entries).has_value());
+}
@@ -49,6 +49,18 @@ struct GetSiblingPathResponse {
     GetSiblingPathResponse& operator=(GetSiblingPathResponse&& other) noexcept = default;
 };
 
+struct GetSiblingPathsResponse {
+    // In the order of the requested indices
+    std::vector<fr_sibling_path> paths;
+
+    GetSiblingPathsResponse() = default;
+    ~GetSiblingPathsResponse() = default;
+    GetSiblingPathsResponse(const GetSiblingPathsResponse& other) = default;
+    GetSiblingPathsResponse(GetSiblingPathsResponse&& other) noexcept = default;
+    GetSiblingPathsResponse& operator=(const GetSiblingPathsResponse& other) = default;
+    GetSiblingPathsResponse& operator=(GetSiblingPathsResponse&& other) noexcept = default;
+};
+
 template <typename LeafType> struct LeafUpdateWitnessData {
     IndexedLeaf<LeafType> leaf;
     index_t index;
@@ -66,6 +78,8 @@ template <typename LeafType> struct LeafUpdateWitnessData {
     LeafUpdateWitnessData& operator=(const LeafUpdateWitnessData& other) = default;
     LeafUpdateWitnessData& operator=(LeafUpdateWitnessData&& other) noexcept = default;
 
+    bool operator==(const LeafUpdateWitnessData& other) const = default;
+
     MSGPACK_FIELDS(leaf, index, path);
 };
 
@@ -1,4 +1,7 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
+
+#include <algorithm>
 
 namespace bb::crypto {
 /**
@@ -10,6 +13,31 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const typename Poseidon2<Params>::FF> children,
+                                   std::span<typename Poseidon2<Params>::FF> parents)
+{
+    using Permutation = Poseidon2Permutation<Params>;
+    constexpr size_t batch_size = Permutation::BATCH_SIZE;
+    static const FF iv = FF(static_cast<uint256_t>(2) << 64);
+    ASSERT(children.size() == 2 * parents.size());
+
+    std::array<typename Permutation::State, batch_size> states;
+    for (size_t i = 0; i < parents.size(); i += batch_size) {
+        const size_t count = std::min(batch_size, parents.size() - i);
+        for (size_t j = 0; j < count; ++j) {
+            states[j] = {};
+            states[j][0] = children[2 * (i + j)];
+            states[j][1] = children[2 * (i + j) + 1];
+            states[j][Params::t - 1] = iv;
+        }
+        Permutation::permutation_batch(std::span(states.data(), count));
+        for (size_t j = 0; j < count; ++j) {
+            parents[i + j] = states[j][0];
+        }
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -4,6 +4,11 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -17,6 +22,47 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes a fixed number of field elements
+     * @details Equal to hash() of the same elements, but the sponge is run on a stack-allocated state, so it does not
+     * touch the heap. Use this (or hash2/3/4) wherever the number of inputs is known at compile time.
+     */
+    template <size_t N> static FF hash(const std::array<FF, N>& input)
+    {
+        static_assert(N > 0, "the sponge is not defined for an empty input");
+        using Permutation = Poseidon2Permutation<Params>;
+        constexpr size_t rate = Params::t - 1;
+
+        // The domain separator of the sponge for N inputs and 1 output
+        typename Permutation::State state{};
+        state[rate] = FF(static_cast<uint256_t>(N) << 64);
+        // Absorbing adds the inputs into the state, a chunk of rate elements at a time, and squeezing the output
+        // permutes the last (possibly partial) chunk as well. So there is one permutation per chunk.
+        for (size_t i = 0; i < N; i += rate) {
+            for (size_t j = 0; j < rate && i + j < N; ++j) {
+                state[j] += input[i + j];
+            }
+            state = Permutation::permutation(state);
+        }
+        return state[0];
+    }
+
+    static FF hash2(const FF& a, const FF& b) { return hash(std::array<FF, 2>{ a, b }); }
+    static FF hash3(const FF& a, const FF& b, const FF& c) { return hash(std::array<FF, 3>{ a, b, c }); }
+    static FF hash4(const FF& a, const FF& b, const FF& c, const FF& d)
+    {
+        return hash(std::array<FF, 4>{ a, b, c, d });
+    }
+
+    /**
+     * @brief Hashes two field elements, e.g. the children of a Merkle tree node
+     */
+    static FF hash_pair(const FF& left, const FF& right) { return hash2(left, right); }
+    /**
+     * @brief Computes parents[i] = hash_pair(children[2i], children[2i + 1]), e.g. for a level of a Merkle tree
+     * @details The pairs are permuted BATCH_SIZE at a time with Poseidon2Permutation::permutation_batch.
+     */
+    static void hash_pairs(std::span<const FF> children, std::span<FF> parents);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -28,6 +28,55 @@ TEST(Poseidon2, HashBasicTests)
     EXPECT_NE(r0, r2);
 }
 
+TEST(Poseidon2, HashPairMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    for (size_t i = 0; i < 8; ++i) {
+        fr left = fr::random_element(&engine);
+        fr right = fr::random_element(&engine);
+        EXPECT_EQ(Poseidon2::hash_pair(left, right), Poseidon2::hash({ left, right }));
+    }
+    EXPECT_EQ(Poseidon2::hash_pair(fr::zero(), fr::zero()), Poseidon2::hash({ fr::zero(), fr::zero() }));
+}
+
+TEST(Poseidon2, FixedArityMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    std::array<fr, 7> inputs;
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    const auto& [a, b, c, d, e, f, g] = inputs;
+
+    EXPECT_EQ(Poseidon2::hash2(a, b), Poseidon2::hash({ a, b }));
+    EXPECT_EQ(Poseidon2::hash3(a, b, c), Poseidon2::hash({ a, b, c }));
+    EXPECT_EQ(Poseidon2::hash4(a, b, c, d), Poseidon2::hash({ a, b, c, d }));
+    // Inputs that do not fit into a single permutation, with full and partial last chunks
+    EXPECT_EQ(Poseidon2::hash(std::array<fr, 1>{ a }), Poseidon2::hash({ a }));
+    EXPECT_EQ(Poseidon2::hash(std::array<fr, 6>{ a, b, c, d, e, f }), Poseidon2::hash({ a, b, c, d, e, f }));
+    EXPECT_EQ(Poseidon2::hash(inputs), Poseidon2::hash({ a, b, c, d, e, f, g }));
+}
+
+TEST(Poseidon2, HashPairsMatchesHashPair)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Sizes around the batch size of the permutation
+    for (size_t num_pairs = 0; num_pairs < 10; ++num_pairs) {
+        std::vector<fr> children(2 * num_pairs);
+        for (auto& child : children) {
+            child = fr::random_element(&engine);
+        }
+        std::vector<fr> parents(num_pairs);
+        Poseidon2::hash_pairs(children, parents);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            EXPECT_EQ(parents[i], Poseidon2::hash_pair(children[2 * i], children[2 * i + 1]));
+        }
+    }
+}
+
 // N.B. these hardcoded values were extracted from the algorithm being tested. These are NOT independent test vectors!
 // TODO(@zac-williamson #3132): find independent test vectors we can compare against! (very hard to find given
 // flexibility of Poseidon's parametrisation)
@@ -7,6 +7,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -160,5 +161,74 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    // The number of states that permutation_batch moves through the rounds together
+    static constexpr size_t BATCH_SIZE = 4;
+
+    /**
+     * @brief Applies the permutation to each of the given states, in place
+     * @details The result is the same as state = permutation(state) for every state. A single permutation is mostly
+     * a chain of dependent multiplications (the sbox of the partial rounds), so it has to wait out the latency of every
+     * one of them. Here groups of BATCH_SIZE states go through the rounds in lockstep. Each step of each round is
+     * applied to the whole group before the next step, which leaves the CPU several independent multiplications to
+     * overlap.
+     */
+    static void permutation_batch(std::span<State> states)
+    {
+        size_t i = 0;
+        for (; i + BATCH_SIZE <= states.size(); i += BATCH_SIZE) {
+            permutation_interleaved<BATCH_SIZE>(states.subspan(i).template first<BATCH_SIZE>());
+        }
+        for (; i < states.size(); ++i) {
+            states[i] = permutation(states[i]);
+        }
+    }
+
+  private:
+    template <size_t B> static void permutation_interleaved(std::span<State, B> states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            external_round_interleaved(states, round_constants[i]);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            // x^5 on the first element of every state, one squaring/multiplication at a time across the group
+            std::array<FF, B> powers;
+            for (size_t j = 0; j < B; ++j) {
+                states[j][0] += round_constants[i][0];
+                powers[j] = states[j][0].sqr();
+            }
+            for (size_t j = 0; j < B; ++j) {
+                powers[j] = powers[j].sqr();
+            }
+            for (size_t j = 0; j < B; ++j) {
+                states[j][0] *= powers[j];
+                matrix_multiplication_internal(states[j]);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            external_round_interleaved(states, round_constants[i]);
+        }
+    }
+
+    template <size_t B> static void external_round_interleaved(std::span<State, B> states, const RoundConstants& rc)
+    {
+        for (auto& state : states) {
+            add_round_constants(state, rc);
+        }
+        for (auto& state : states) {
+            apply_sbox(state);
+        }
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+    }
 };
 } // namespace bb::crypto
@@ -1,4 +1,5 @@
 #include "fr.hpp"
+#include "barretenberg/ecc/fields/field_vector.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -447,5 +448,83 @@ void hash_bench(State& state) noexcept
 }
 BENCHMARK(hash_bench);
 
+// Bulk operations over a span, element by element (scalar) vs field_vector (IFMA when the CPU supports it).
+constexpr size_t NUM_BULK_ELEMENTS = 1 << 16;
+
+void bulk_mul_scalar_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx.begin(), oldx.begin() + NUM_BULK_ELEMENTS);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_BULK_ELEMENTS; ++i) {
+            acc[i] *= oldy[i];
+        }
+        DoNotOptimize(acc.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BULK_ELEMENTS));
+}
+BENCHMARK(bulk_mul_scalar_bench);
+
+void bulk_mul_vector_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx.begin(), oldx.begin() + NUM_BULK_ELEMENTS);
+    const std::span<const fr> values(oldy.data(), NUM_BULK_ELEMENTS);
+    for (auto _ : state) {
+        field_vector::mul<fr>(acc, values);
+        DoNotOptimize(acc.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BULK_ELEMENTS));
+}
+BENCHMARK(bulk_mul_vector_bench);
+
+void bulk_add_scaled_scalar_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx.begin(), oldx.begin() + NUM_BULK_ELEMENTS);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_BULK_ELEMENTS; ++i) {
+            acc[i] += accz * oldy[i];
+        }
+        DoNotOptimize(acc.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BULK_ELEMENTS));
+}
+BENCHMARK(bulk_add_scaled_scalar_bench);
+
+void bulk_add_scaled_vector_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx.begin(), oldx.begin() + NUM_BULK_ELEMENTS);
+    const std::span<const fr> values(oldy.data(), NUM_BULK_ELEMENTS);
+    for (auto _ : state) {
+        field_vector::add_scaled<fr>(acc, values, accz);
+        DoNotOptimize(acc.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BULK_ELEMENTS));
+}
+BENCHMARK(bulk_add_scaled_vector_bench);
+
+void bulk_add_scalar_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx.begin(), oldx.begin() + NUM_BULK_ELEMENTS);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_BULK_ELEMENTS; ++i) {
+            acc[i] += oldy[i];
+        }
+        DoNotOptimize(acc.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BULK_ELEMENTS));
+}
+BENCHMARK(bulk_add_scalar_bench);
+
+void bulk_add_vector_bench(State& state) noexcept
+{
+    std::vector<fr> acc(oldx.begin(), oldx.begin() + NUM_BULK_ELEMENTS);
+    const std::span<const fr> values(oldy.data(), NUM_BULK_ELEMENTS);
+    for (auto _ : state) {
+        field_vector::add<fr>(acc, values);
+        DoNotOptimize(acc.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BULK_ELEMENTS));
+}
+BENCHMARK(bulk_add_vector_bench);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
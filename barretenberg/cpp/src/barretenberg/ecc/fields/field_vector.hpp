@@ -0,0 +1,421 @@
+#pragma once
+
+#include "barretenberg/ecc/fields/field.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#if defined(__x86_64__) && !defined(__wasm__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define BB_FIELD_VECTOR_IFMA 1
+#else
+#define BB_FIELD_VECTOR_IFMA 0
+#endif
+
+/**
+ * @brief Bulk ("field vector") arithmetic over spans of field elements.
+ *
+ * @details Every function has the semantics of the obvious element-by-element loop and produces values in the same
+ * coarse [0, 2p) form as the scalar operators. When the CPU supports AVX-512 IFMA (checked once at runtime) and the
+ * field is a 254-bit Montgomery field (i.e. the ones with the coarse-reduction asm path: bn254 fr and fq), elements
+ * are processed 8 at a time:
+ *
+ *  - 8 consecutive elements are transposed into 4 vectors, one per 64-bit limb, and re-split into 5 limbs of 52 bits.
+ *  - multiplication is a word-by-word Montgomery multiplication with R = 2^260, built on vpmadd52{lo,hi}uq. Our
+ *    elements are in Montgomery form with R = 2^256, so one operand is scaled by 2^4 during the limb split (which fits
+ *    in 5 x 52 bits without a reduction). For inputs in [0, 2p) the output is in [0, 2p), as in the scalar code.
+ *  - additions and subtractions are done on the 52-bit limbs, followed by a conditional subtraction of 2p.
+ *
+ * Leftover elements, other fields and other CPUs use the scalar operators.
+ */
+namespace bb::field_vector {
+
+namespace detail {
+
+template <typename Fr>
+concept IfmaField = requires { typename Fr::Params; } && std::is_same_v<Fr, field<typename Fr::Params>> &&
+                    (Fr::Params::modulus_3 < 0x4000000000000000ULL) && (Fr::Params::modulus_3 != 0);
+
+#if BB_FIELD_VECTOR_IFMA
+inline bool cpu_has_ifma()
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+}
+
+constexpr size_t LANES = 8;
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+// Splits a 256-bit value, given as 64-bit limbs, into 52-bit limbs. `Shift` bits are shifted in at the bottom.
+template <size_t Shift> constexpr std::array<uint64_t, 5> to_radix_52(const std::array<uint64_t, 4>& x)
+{
+    static_assert(Shift < 12);
+    return { (x[0] << Shift) & LIMB_MASK,
+             ((x[0] >> (52 - Shift)) | (x[1] << (12 + Shift))) & LIMB_MASK,
+             ((x[1] >> (40 - Shift)) | (x[2] << (24 + Shift))) & LIMB_MASK,
+             ((x[2] >> (28 - Shift)) | (x[3] << (36 + Shift))) & LIMB_MASK,
+             x[3] >> (16 - Shift) };
+}
+
+template <typename Params> struct IfmaConstants {
+    static constexpr std::array<uint64_t, 4> modulus = {
+        Params::modulus_0, Params::modulus_1, Params::modulus_2, Params::modulus_3
+    };
+    // 2p < 2^255, so this does not overflow.
+    static constexpr std::array<uint64_t, 4> twice_modulus = {
+        Params::modulus_0 << 1,
+        (Params::modulus_1 << 1) | (Params::modulus_0 >> 63),
+        (Params::modulus_2 << 1) | (Params::modulus_1 >> 63),
+        (Params::modulus_3 << 1) | (Params::modulus_2 >> 63),
+    };
+    static constexpr std::array<uint64_t, 5> p = to_radix_52<0>(modulus);
+    static constexpr std::array<uint64_t, 5> p2 = to_radix_52<0>(twice_modulus);
+    // -p^{-1} mod 2^52.
+    static constexpr uint64_t r_inv = Params::r_inv & LIMB_MASK;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays)
+// Vector types can't be std::array elements without dropping their alignment attributes.
+// 8 elements as 5 limbs of 52 bits.
+struct Limbs {
+    __m512i v[5];
+};
+// 8 elements as 4 limbs of 64 bits.
+struct Words {
+    __m512i v[4];
+};
+
+// Shifts. The unmasked intrinsics trip GCC's -Wmaybe-uninitialized on their undefined pass-through operand.
+__attribute__((target("avx512f,avx512ifma"))) inline __m512i shl(__m512i x, unsigned int n)
+{
+    return _mm512_maskz_slli_epi64(0xFF, x, n);
+}
+__attribute__((target("avx512f,avx512ifma"))) inline __m512i shr(__m512i x, unsigned int n)
+{
+    return _mm512_maskz_srli_epi64(0xFF, x, n);
+}
+__attribute__((target("avx512f,avx512ifma"))) inline __m512i sar(__m512i x, unsigned int n)
+{
+    return _mm512_maskz_srai_epi64(0xFF, x, n);
+}
+
+__attribute__((target("avx512f,avx512ifma"))) inline Words load_transposed(const uint64_t* ptr)
+{
+    const __m512i idx_pairs_lo = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i idx_pairs_hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i idx_halves_lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i idx_halves_hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    // Each load holds 2 elements.
+    const __m512i v0 = _mm512_loadu_si512(ptr);
+    const __m512i v1 = _mm512_loadu_si512(ptr + 8);
+    const __m512i v2 = _mm512_loadu_si512(ptr + 16);
+    const __m512i v3 = _mm512_loadu_si512(ptr + 24);
+    // Limbs 0/1 and 2/3 of elements 0..3 and 4..7.
+    const __m512i t0 = _mm512_permutex2var_epi64(v0, idx_pairs_lo, v1);
+    const __m512i t1 = _mm512_permutex2var_epi64(v0, idx_pairs_hi, v1);
+    const __m512i t2 = _mm512_permutex2var_epi64(v2, idx_pairs_lo, v3);
+    const __m512i t3 = _mm512_permutex2var_epi64(v2, idx_pairs_hi, v3);
+    return { { _mm512_permutex2var_epi64(t0, idx_halves_lo, t2),
+               _mm512_permutex2var_epi64(t0, idx_halves_hi, t2),
+               _mm512_permutex2var_epi64(t1, idx_halves_lo, t3),
+               _mm512_permutex2var_epi64(t1, idx_halves_hi, t3) } };
+}
+
+__attribute__((target("avx512f,avx512ifma"))) inline void store_transposed(uint64_t* ptr, const Words& x)
+{
+    const __m512i idx_pairs_lo = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i idx_pairs_hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i idx_halves_lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i idx_halves_hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const __m512i t0 = _mm512_permutex2var_epi64(x.v[0], idx_halves_lo, x.v[1]);
+    const __m512i t2 = _mm512_permutex2var_epi64(x.v[0], idx_halves_hi, x.v[1]);
+    const __m512i t1 = _mm512_permutex2var_epi64(x.v[2], idx_halves_lo, x.v[3]);
+    const __m512i t3 = _mm512_permutex2var_epi64(x.v[2], idx_halves_hi, x.v[3]);
+    _mm512_storeu_si512(ptr, _mm512_permutex2var_epi64(t0, idx_pairs_lo, t1));
+    _mm512_storeu_si512(ptr + 8, _mm512_permutex2var_epi64(t0, idx_pairs_hi, t1));
+    _mm512_storeu_si512(ptr + 16, _mm512_permutex2var_epi64(t2, idx_pairs_lo, t3));
+    _mm512_storeu_si512(ptr + 24, _mm512_permutex2var_epi64(t2, idx_pairs_hi, t3));
+}
+
+// Loads 8 elements as 52-bit limbs, multiplied by 2^Shift.
+template <size_t Shift>
+__attribute__((target("avx512f,avx512ifma"))) inline Limbs load(const uint64_t* ptr)
+{
+    const auto x = load_transposed(ptr);
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    const __m512i x1 = _mm512_or_si512(shr(x.v[0], 52 - Shift), shl(x.v[1], 12 + Shift));
+    const __m512i x2 = _mm512_or_si512(shr(x.v[1], 40 - Shift), shl(x.v[2], 24 + Shift));
+    const __m512i x3 = _mm512_or_si512(shr(x.v[2], 28 - Shift), shl(x.v[3], 36 + Shift));
+    return { { _mm512_and_si512(shl(x.v[0], Shift), mask),
+               _mm512_and_si512(x1, mask),
+               _mm512_and_si512(x2, mask),
+               _mm512_and_si512(x3, mask),
+               shr(x.v[3], 16 - Shift) } };
+}
+
+// Stores 8 elements given as normalized 52-bit limbs, of value < 2^256.
+__attribute__((target("avx512f,avx512ifma"))) inline void store(uint64_t* ptr, const Limbs& x)
+{
+    store_transposed(ptr,
+                     { { _mm512_or_si512(x.v[0], shl(x.v[1], 52)),
+                         _mm512_or_si512(shr(x.v[1], 12), shl(x.v[2], 40)),
+                         _mm512_or_si512(shr(x.v[2], 24), shl(x.v[3], 28)),
+                         _mm512_or_si512(shr(x.v[3], 36), shl(x.v[4], 16)) } });
+}
+
+template <size_t Shift>
+__attribute__((target("avx512f,avx512ifma"))) inline Limbs broadcast(const std::array<uint64_t, 4>& x)
+{
+    const auto limbs = to_radix_52<Shift>(x);
+    Limbs result;
+    for (size_t i = 0; i < 5; ++i) {
+        result.v[i] = _mm512_set1_epi64(static_cast<int64_t>(limbs[i]));
+    }
+    return result;
+}
+
+// Propagates (signed) carries so that limbs 0..3 are in [0, 2^52).
+__attribute__((target("avx512f,avx512ifma"))) inline void normalize(Limbs& x)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    for (size_t i = 0; i < 4; ++i) {
+        x.v[i + 1] = _mm512_add_epi64(x.v[i + 1], sar(x.v[i], 52));
+        x.v[i] = _mm512_and_si512(x.v[i], mask);
+    }
+}
+
+// Given normalized x < 2 * q, returns x mod q.
+__attribute__((target("avx512f,avx512ifma"))) inline Limbs reduce_once(const Limbs& x, const std::array<uint64_t, 5>& q)
+{
+    Limbs diff;
+    for (size_t i = 0; i < 5; ++i) {
+        diff.v[i] = _mm512_sub_epi64(x.v[i], _mm512_set1_epi64(static_cast<int64_t>(q[i])));
+    }
+    normalize(diff);
+    // The top limb is negative iff x < q.
+    const __mmask8 keep = _mm512_cmplt_epi64_mask(diff.v[4], _mm512_setzero_si512());
+    Limbs result;
+    for (size_t i = 0; i < 5; ++i) {
+        result.v[i] = _mm512_mask_blend_epi64(keep, diff.v[i], x.v[i]);
+    }
+    return result;
+}
+
+/**
+ * @brief Montgomery multiplication with R = 2^260. Requires a < 2p and b < 32p (i.e. b may carry the 2^4 factor that
+ * turns this into a multiplication with R = 2^256). The result is normalized and < 2p.
+ */
+template <typename Params>
+__attribute__((target("avx512f,avx512ifma"))) inline Limbs montgomery_mul(const Limbs& a, const Limbs& b)
+{
+    using C = IfmaConstants<Params>;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i r_inv = _mm512_set1_epi64(static_cast<int64_t>(C::r_inv));
+    __m512i p[5];
+    for (size_t j = 0; j < 5; ++j) {
+        p[j] = _mm512_set1_epi64(static_cast<int64_t>(C::p[j]));
+    }
+    // Limbs accumulate at most ~20 products of 52 bits, so they never overflow 64 bits.
+    __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], a.v[i], b.v[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a.v[i], b.v[j]);
+        }
+        const __m512i m = _mm512_madd52lo_epu64(zero, t[0], r_inv);
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], m, p[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, p[j]);
+        }
+        // The low 52 bits of t[0] are now zero: divide by 2^52.
+        t[1] = _mm512_add_epi64(t[1], shr(t[0], 52));
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[5] = zero;
+    }
+    Limbs result{ { t[0], t[1], t[2], t[3], t[4] } };
+    normalize(result);
+    return result;
+}
+
+template <typename Fr> uint64_t* limbs_of(Fr* ptr)
+{
+    return &ptr->data[0];
+}
+template <typename Fr> const uint64_t* limbs_of(const Fr* ptr)
+{
+    return &ptr->data[0];
+}
+
+template <typename Fr>
+__attribute__((target("avx512f,avx512ifma"))) size_t mul_ifma(std::span<Fr> acc, std::span<const Fr> values)
+{
+    using Params = typename Fr::Params;
+    const size_t num_vectors = acc.size() / LANES;
+    for (size_t i = 0; i < num_vectors; ++i) {
+        const Limbs a = load<0>(limbs_of(&acc[i * LANES]));
+        const Limbs b = load<4>(limbs_of(&values[i * LANES]));
+        store(limbs_of(&acc[i * LANES]), montgomery_mul<Params>(a, b));
+    }
+    return num_vectors * LANES;
+}
+
+template <typename Fr>
+__attribute__((target("avx512f,avx512ifma"))) size_t scale_ifma(std::span<Fr> acc, const Fr& scalar)
+{
+    using Params = typename Fr::Params;
+    const Limbs b = broadcast<4>({ scalar.data[0], scalar.data[1], scalar.data[2], scalar.data[3] });
+    const size_t num_vectors = acc.size() / LANES;
+    for (size_t i = 0; i < num_vectors; ++i) {
+        const Limbs a = load<0>(limbs_of(&acc[i * LANES]));
+        store(limbs_of(&acc[i * LANES]), montgomery_mul<Params>(a, b));
+    }
+    return num_vectors * LANES;
+}
+
+template <typename Fr>
+__attribute__((target("avx512f,avx512ifma"))) size_t add_scaled_ifma(std::span<Fr> acc,
+                                                                      std::span<const Fr> values,
+                                                                      const Fr& scalar)
+{
+    using Params = typename Fr::Params;
+    const Limbs b = broadcast<4>({ scalar.data[0], scalar.data[1], scalar.data[2], scalar.data[3] });
+    const size_t num_vectors = acc.size() / LANES;
+    for (size_t i = 0; i < num_vectors; ++i) {
+        const Limbs a = load<0>(limbs_of(&values[i * LANES]));
+        Limbs sum = montgomery_mul<Params>(a, b);
+        const Limbs c = load<0>(limbs_of(&acc[i * LANES]));
+        for (size_t j = 0; j < 5; ++j) {
+            sum.v[j] = _mm512_add_epi64(sum.v[j], c.v[j]);
+        }
+        normalize(sum);
+        store(limbs_of(&acc[i * LANES]), reduce_once(sum, IfmaConstants<Params>::p2));
+    }
+    return num_vectors * LANES;
+}
+
+template <typename Fr, bool Subtract>
+__attribute__((target("avx512f,avx512ifma"))) size_t add_ifma(std::span<Fr> acc, std::span<const Fr> values)
+{
+    using Params = typename Fr::Params;
+    const size_t num_vectors = acc.size() / LANES;
+    for (size_t i = 0; i < num_vectors; ++i) {
+        Limbs a = load<0>(limbs_of(&acc[i * LANES]));
+        const Limbs b = load<0>(limbs_of(&values[i * LANES]));
+        for (size_t j = 0; j < 5; ++j) {
+            if constexpr (Subtract) {
+                // a + 2p - b is in (0, 4p).
+                const __m512i p2 = _mm512_set1_epi64(static_cast<int64_t>(IfmaConstants<Params>::p2[j]));
+                a.v[j] = _mm512_sub_epi64(_mm512_add_epi64(a.v[j], p2), b.v[j]);
+            } else {
+                a.v[j] = _mm512_add_epi64(a.v[j], b.v[j]);
+            }
+        }
+        normalize(a);
+        store(limbs_of(&acc[i * LANES]), reduce_once(a, IfmaConstants<Params>::p2));
+    }
+    return num_vectors * LANES;
+}
+// NOLINTEND(cppcoreguidelines-avoid-c-arrays)
+#endif
+
+} // namespace detail
+
+/**
+ * @brief acc[i] *= values[i]
+ */
+template <typename Fr> void mul(std::span<Fr> acc, std::span<const Fr> values)
+{
+    ASSERT(acc.size() == values.size());
+    size_t start = 0;
+#if BB_FIELD_VECTOR_IFMA
+    if constexpr (detail::IfmaField<Fr>) {
+        if (detail::cpu_has_ifma()) {
+            start = detail::mul_ifma(acc, values);
+        }
+    }
+#endif
+    for (size_t i = start; i < acc.size(); ++i) {
+        acc[i] *= values[i];
+    }
+}
+
+/**
+ * @brief acc[i] *= scalar
+ */
+template <typename Fr> void scale(std::span<Fr> acc, const Fr& scalar)
+{
+    size_t start = 0;
+#if BB_FIELD_VECTOR_IFMA
+    if constexpr (detail::IfmaField<Fr>) {
+        if (detail::cpu_has_ifma()) {
+            start = detail::scale_ifma(acc, scalar);
+        }
+    }
+#endif
+    for (size_t i = start; i < acc.size(); ++i) {
+        acc[i] *= scalar;
+    }
+}
+
+/**
+ * @brief acc[i] += scalar * values[i]
+ */
+template <typename Fr> void add_scaled(std::span<Fr> acc, std::span<const Fr> values, const Fr& scalar)
+{
+    ASSERT(acc.size() == values.size());
+    size_t start = 0;
+#if BB_FIELD_VECTOR_IFMA
+    if constexpr (detail::IfmaField<Fr>) {
+        if (detail::cpu_has_ifma()) {
+            start = detail::add_scaled_ifma(acc, values, scalar);
+        }
+    }
+#endif
+    for (size_t i = start; i < acc.size(); ++i) {
+        acc[i] += scalar * values[i];
+    }
+}
+
+/**
+ * @brief acc[i] += values[i]
+ */
+template <typename Fr> void add(std::span<Fr> acc, std::span<const Fr> values)
+{
+    ASSERT(acc.size() == values.size());
+    size_t start = 0;
+#if BB_FIELD_VECTOR_IFMA
+    if constexpr (detail::IfmaField<Fr>) {
+        if (detail::cpu_has_ifma()) {
+            start = detail::add_ifma<Fr, /*Subtract=*/false>(acc, values);
+        }
+    }
+#endif
+    for (size_t i = start; i < acc.size(); ++i) {
+        acc[i] += values[i];
+    }
+}
+
+/**
+ * @brief acc[i] -= values[i]
+ */
+template <typename Fr> void sub(std::span<Fr> acc, std::span<const Fr> values)
+{
+    ASSERT(acc.size() == values.size());
+    size_t start = 0;
+#if BB_FIELD_VECTOR_IFMA
+    if constexpr (detail::IfmaField<Fr>) {
+        if (detail::cpu_has_ifma()) {
+            start = detail::add_ifma<Fr, /*Subtract=*/true>(acc, values);
+        }
+    }
+#endif
+    for (size_t i = start; i < acc.size(); ++i) {
+        acc[i] -= values[i];
+    }
+}
+
+} // namespace bb::field_vector
@@ -0,0 +1,114 @@
+#include "barretenberg/ecc/fields/field_vector.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+// Random elements, a third of them in the non-canonical [p, 2p) form produced by coarse reduction.
+template <typename Fr> std::vector<Fr> random_elements(size_t n)
+{
+    std::vector<Fr> result(n);
+    for (size_t i = 0; i < n; ++i) {
+        result[i] = Fr::random_element(&engine).reduce_once();
+        if (i % 3 == 0) {
+            const auto& limbs = result[i].data;
+            const uint256_t coarse = uint256_t(limbs[0], limbs[1], limbs[2], limbs[3]) + Fr::modulus;
+            result[i].data[0] = coarse.data[0];
+            result[i].data[1] = coarse.data[1];
+            result[i].data[2] = coarse.data[2];
+            result[i].data[3] = coarse.data[3];
+        }
+    }
+    // Edge cases.
+    if (n > 2) {
+        result[1] = Fr(0);
+        result[2] = -Fr(1);
+    }
+    return result;
+}
+
+// Checks both the value and that the result stays in the coarse [0, 2p) form.
+template <typename Fr> void expect_equal(const std::vector<Fr>& actual, const std::vector<Fr>& expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i], expected[i]) << "at index " << i;
+        EXPECT_LT(uint256_t(actual[i].data[0], actual[i].data[1], actual[i].data[2], actual[i].data[3]),
+                  Fr::modulus + Fr::modulus)
+            << "at index " << i;
+    }
+}
+} // namespace
+
+template <typename Fr> class FieldVectorTest : public testing::Test {};
+
+using FieldTypes = testing::Types<bb::fr, bb::fq>;
+TYPED_TEST_SUITE(FieldVectorTest, FieldTypes);
+
+// 67 covers full 8-element vectors plus a scalar tail.
+constexpr size_t NUM_ELEMENTS = 67;
+
+TYPED_TEST(FieldVectorTest, Mul)
+{
+    using Fr = TypeParam;
+    auto acc = random_elements<Fr>(NUM_ELEMENTS);
+    const auto values = random_elements<Fr>(NUM_ELEMENTS);
+    auto expected = acc;
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        expected[i] *= values[i];
+    }
+    field_vector::mul<Fr>(acc, values);
+    expect_equal(acc, expected);
+}
+
+TYPED_TEST(FieldVectorTest, Scale)
+{
+    using Fr = TypeParam;
+    auto acc = random_elements<Fr>(NUM_ELEMENTS);
+    const Fr scalar = Fr::random_element(&engine);
+    auto expected = acc;
+    for (auto& value : expected) {
+        value *= scalar;
+    }
+    field_vector::scale<Fr>(acc, scalar);
+    expect_equal(acc, expected);
+}
+
+TYPED_TEST(FieldVectorTest, AddScaled)
+{
+    using Fr = TypeParam;
+    auto acc = random_elements<Fr>(NUM_ELEMENTS);
+    const auto values = random_elements<Fr>(NUM_ELEMENTS);
+    const Fr scalar = -Fr(1);
+    auto expected = acc;
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        expected[i] += scalar * values[i];
+    }
+    field_vector::add_scaled<Fr>(acc, values, scalar);
+    expect_equal(acc, expected);
+}
+
+TYPED_TEST(FieldVectorTest, AddAndSub)
+{
+    using Fr = TypeParam;
+    const auto initial = random_elements<Fr>(NUM_ELEMENTS);
+    const auto values = random_elements<Fr>(NUM_ELEMENTS);
+    auto sum = initial;
+    auto difference = initial;
+    auto expected_sum = initial;
+    auto expected_difference = initial;
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        expected_sum[i] += values[i];
+        expected_difference[i] -= values[i];
+    }
+    field_vector::add<Fr>(sum, values);
+    field_vector::sub<Fr>(difference, values);
+    expect_equal(sum, expected_sum);
+    expect_equal(difference, expected_difference);
+}
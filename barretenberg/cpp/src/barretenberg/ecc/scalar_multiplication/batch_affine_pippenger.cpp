@@ -0,0 +1,312 @@
+#include "./batch_affine_pippenger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+// Maximum number of independent affine additions evaluated with one batch inversion
+constexpr size_t MAX_AFFINE_BATCH_SIZE = 1024;
+
+/**
+ * @brief A set of affine buckets for one window of one point range.
+ * @details Additions into the buckets are collected into a batch and evaluated with a single batch inversion once the
+ * batch is full. Each batch entry computes lhs + rhs and either writes the result into its bucket (if lhs is the bucket
+ * itself) or feeds it back into the bucket as a new point (if lhs and rhs were two points paired in a spare slot).
+ */
+template <typename Curve> class AffineBucketAccumulator {
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+
+  public:
+    explicit AffineBucketAccumulator(const size_t num_buckets)
+        : buckets(num_buckets)
+        , bucket_occupied(num_buckets, 0)
+        , bucket_in_batch(num_buckets, 0)
+        , spares(num_buckets)
+        , spare_occupied(num_buckets, 0)
+    {
+        batch.reserve(MAX_AFFINE_BATCH_SIZE);
+        denominators.reserve(MAX_AFFINE_BATCH_SIZE);
+        numerators.reserve(MAX_AFFINE_BATCH_SIZE);
+        differences.reserve(MAX_AFFINE_BATCH_SIZE);
+    }
+
+    void add(const uint32_t bucket_idx, const AffineElement& point)
+    {
+        if (bucket_occupied[bucket_idx] == 0) {
+            buckets[bucket_idx] = point;
+            bucket_occupied[bucket_idx] = 1;
+        } else if (bucket_in_batch[bucket_idx] == 0) {
+            bucket_in_batch[bucket_idx] = 1;
+            batch.push_back({ bucket_idx, true, buckets[bucket_idx], point });
+        } else if (spare_occupied[bucket_idx] != 0) {
+            spare_occupied[bucket_idx] = 0;
+            batch.push_back({ bucket_idx, false, spares[bucket_idx], point });
+        } else {
+            spares[bucket_idx] = point;
+            spare_occupied[bucket_idx] = 1;
+            spare_buckets.push_back(bucket_idx);
+        }
+        if (batch.size() >= MAX_AFFINE_BATCH_SIZE) {
+            evaluate_batch();
+        }
+    }
+
+    /**
+     * @brief Evaluate all outstanding additions so that every point added so far is accounted for in `buckets`.
+     */
+    void finalize()
+    {
+        while (!batch.empty() || !spare_buckets.empty()) {
+            std::vector<uint32_t> pending_spares;
+            pending_spares.swap(spare_buckets);
+            for (const uint32_t bucket_idx : pending_spares) {
+                if (spare_occupied[bucket_idx] != 0) {
+                    spare_occupied[bucket_idx] = 0;
+                    add(bucket_idx, spares[bucket_idx]);
+                }
+            }
+            evaluate_batch();
+        }
+    }
+
+    /**
+     * @brief Compute sum_b (b + 1) * buckets[b] via a running sum from the top bucket down.
+     */
+    typename Curve::Element reduce() const
+    {
+        typename Curve::Element running_sum;
+        typename Curve::Element result;
+        running_sum.self_set_infinity();
+        result.self_set_infinity();
+        for (size_t b = buckets.size() - 1; b < buckets.size(); --b) {
+            if (bucket_occupied[b] != 0) {
+                running_sum += buckets[b];
+            }
+            result += running_sum;
+        }
+        return result;
+    }
+
+  private:
+    struct BatchEntry {
+        uint32_t bucket_idx;
+        bool into_bucket;
+        AffineElement lhs;
+        AffineElement rhs;
+    };
+
+    /**
+     * @brief Evaluate the current batch of additions using one field inversion.
+     * @details For P + Q with P.x != Q.x the slope is (Q.y - P.y) / (Q.x - P.x); for P == Q it is (3x^2 + a) / 2y. If
+     * P == -Q the sum is the point at infinity, which we record with a dummy denominator of 1.
+     */
+    void evaluate_batch()
+    {
+        if (batch.empty()) {
+            return;
+        }
+        const size_t batch_size = batch.size();
+        denominators.resize(batch_size);
+        numerators.resize(batch_size);
+        differences.resize(batch_size);
+
+        // Compute the slope numerators and denominators, and overwrite the denominators with their prefix products
+        Fq accumulator = Fq::one();
+        for (size_t i = 0; i < batch_size; ++i) {
+            const auto& [bucket_idx, into_bucket, lhs, rhs] = batch[i];
+            Fq denominator;
+            if (lhs.x == rhs.x) {
+                if (lhs.y == rhs.y) {
+                    const Fq x_sqr = lhs.x.sqr();
+                    numerators[i] = x_sqr + x_sqr + x_sqr;
+                    if constexpr (Curve::Group::has_a) {
+                        numerators[i] += Curve::Group::curve_a;
+                    }
+                    denominator = lhs.y + lhs.y;
+                } else {
+                    numerators[i] = Fq::zero();
+                    denominator = Fq::one();
+                    batch[i].lhs.self_set_infinity();
+                }
+            } else {
+                numerators[i] = rhs.y - lhs.y;
+                denominator = rhs.x - lhs.x;
+            }
+            differences[i] = denominator;
+            denominators[i] = accumulator;
+            accumulator *= denominator;
+        }
+
+        Fq inverse = accumulator.invert();
+
+        feedback.clear();
+        for (size_t i = batch_size - 1; i < batch_size; --i) {
+            auto& entry = batch[i];
+            const Fq denominator_inverse = denominators[i] * inverse;
+            inverse *= differences[i];
+
+            const uint32_t bucket_idx = entry.bucket_idx;
+            if (entry.lhs.is_point_at_infinity()) {
+                if (entry.into_bucket) {
+                    bucket_occupied[bucket_idx] = 0;
+                    bucket_in_batch[bucket_idx] = 0;
+                }
+                continue;
+            }
+            const Fq lambda = numerators[i] * denominator_inverse;
+            const Fq x3 = lambda.sqr() - entry.lhs.x - entry.rhs.x;
+            const Fq y3 = lambda * (entry.lhs.x - x3) - entry.lhs.y;
+            if (entry.into_bucket) {
+                buckets[bucket_idx] = AffineElement(x3, y3);
+                bucket_in_batch[bucket_idx] = 0;
+            } else {
+                feedback.push_back({ bucket_idx, AffineElement(x3, y3) });
+            }
+        }
+        batch.clear();
+
+        // Sums of paired points re-enter their buckets as new points. This may trigger a nested batch evaluation, so
+        // iterate over a copy of the feedback list
+        std::vector<std::pair<uint32_t, AffineElement>> pending_feedback;
+        pending_feedback.swap(feedback);
+        for (const auto& [bucket_idx, point] : pending_feedback) {
+            add(bucket_idx, point);
+        }
+    }
+
+  public:
+    std::vector<AffineElement> buckets;
+    std::vector<uint8_t> bucket_occupied;
+
+  private:
+    std::vector<uint8_t> bucket_in_batch;
+    std::vector<AffineElement> spares;
+    std::vector<uint8_t> spare_occupied;
+    std::vector<uint32_t> spare_buckets;
+    std::vector<BatchEntry> batch;
+    std::vector<Fq> denominators;
+    std::vector<Fq> numerators;
+    std::vector<Fq> differences;
+    std::vector<std::pair<uint32_t, AffineElement>> feedback;
+};
+
+} // namespace
+
+size_t get_batch_affine_window_bits(const size_t num_points, const size_t num_threads)
+{
+    // Rough costs in field multiplications: a batched affine bucket addition, and the two projective additions per
+    // bucket in the running-sum reduction
+    constexpr size_t ACCUMULATION_COST = 7;
+    constexpr size_t REDUCTION_COST = 27;
+    constexpr size_t MIN_WINDOW_BITS = 2;
+    constexpr size_t MAX_WINDOW_BITS = 16;
+
+    size_t best_window_bits = MIN_WINDOW_BITS;
+    size_t best_cost = std::numeric_limits<size_t>::max();
+    for (size_t window_bits = MIN_WINDOW_BITS; window_bits <= MAX_WINDOW_BITS; ++window_bits) {
+        const size_t num_windows = get_num_signed_windows(window_bits);
+        const size_t num_chunks = std::max<size_t>(1, (num_threads + num_windows - 1) / num_windows);
+        const size_t num_buckets = 1UL << (window_bits - 1);
+        const size_t cost = num_windows * (num_points * ACCUMULATION_COST + num_chunks * num_buckets * REDUCTION_COST);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_window_bits = window_bits;
+        }
+    }
+    return best_window_bits;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_batch_affine(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                               std::span<const typename Curve::AffineElement> points)
+{
+    PROFILE_THIS();
+
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    ASSERT(scalars.end_index() * 2 <= points.size());
+
+    Element result;
+    result.self_set_infinity();
+    const size_t num_points = scalars.size() * 2;
+    if (num_points == 0) {
+        return result;
+    }
+    const auto table = points.subspan(scalars.start_index * 2, num_points);
+
+    // Endomorphism split of the scalars, interleaved to match the point table layout
+    std::vector<std::array<uint64_t, 2>> split_scalars(num_points);
+    parallel_for_range(scalars.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            const Fr& scalar = scalars[scalars.start_index + i];
+            if (scalar.is_zero()) {
+                split_scalars[2 * i] = { 0, 0 };
+                split_scalars[2 * i + 1] = { 0, 0 };
+                continue;
+            }
+            auto [k1, k2] = Fr::split_into_endomorphism_scalars(scalar.from_montgomery_form());
+            split_scalars[2 * i] = k1;
+            split_scalars[2 * i + 1] = k2;
+        }
+    });
+
+    const size_t num_threads = get_num_cpus();
+    const size_t window_bits = get_batch_affine_window_bits(num_points, num_threads);
+    const size_t num_windows = get_num_signed_windows(window_bits);
+    const size_t num_buckets = 1UL << (window_bits - 1);
+    const size_t num_chunks =
+        std::min(num_points, std::max<size_t>(1, (num_threads + num_windows - 1) / num_windows));
+    const size_t chunk_size = (num_points + num_chunks - 1) / num_chunks;
+
+    // Each (window, chunk) task owns its buckets, so tasks never contend
+    std::vector<Element> task_results(num_windows * num_chunks);
+    parallel_for(task_results.size(), [&](size_t task_idx) {
+        const size_t window_idx = task_idx / num_chunks;
+        const size_t start = (task_idx % num_chunks) * chunk_size;
+        const size_t end = std::min(start + chunk_size, num_points);
+
+        AffineBucketAccumulator<Curve> accumulator(num_buckets);
+        for (size_t i = start; i < end; ++i) {
+            const int64_t digit = get_signed_digit(split_scalars[i], window_bits, window_idx);
+            if (digit == 0 || table[i].is_point_at_infinity()) {
+                continue;
+            }
+            if (digit > 0) {
+                accumulator.add(static_cast<uint32_t>(digit - 1), table[i]);
+            } else {
+                accumulator.add(static_cast<uint32_t>(-digit - 1), -table[i]);
+            }
+        }
+        accumulator.finalize();
+        task_results[task_idx] = accumulator.reduce();
+    });
+
+    // Horner over the windows, from the most significant down
+    for (size_t window_idx = num_windows - 1; window_idx < num_windows; --window_idx) {
+        for (size_t k = 0; k < window_bits; ++k) {
+            result.self_dbl();
+        }
+        for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            result += task_results[window_idx * num_chunks + chunk_idx];
+        }
+    }
+    return result;
+}
+
+template curve::BN254::Element pippenger_batch_affine<curve::BN254>(
+    PolynomialSpan<const curve::BN254::ScalarField> scalars, std::span<const curve::BN254::AffineElement> points);
+
+template curve::Grumpkin::Element pippenger_batch_affine<curve::Grumpkin>(
+    PolynomialSpan<const curve::Grumpkin::ScalarField> scalars, std::span<const curve::Grumpkin::AffineElement> points);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "./scalar_multiplication.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Pippenger with signed-digit (Booth) windows and batched affine bucket accumulation.
+ *
+ * @details An alternative MSM backend to `pippenger`/`pippenger_unsafe`. The differences are:
+ *
+ * 1. Scalars are recoded into signed digits in [-2^{c-1}, 2^{c-1}] (see get_signed_digit), so a c-bit window only needs
+ *    2^{c-1} buckets and there is no skew correction. Digits are computed on the fly per window as they do not depend
+ *    on a carry chain.
+ * 2. Buckets are kept in affine form. Points are streamed into their buckets in input order and the resulting
+ *    additions are collected into a batch that is evaluated with a single Montgomery batch inversion, i.e. ~6 field
+ *    multiplications per addition instead of the 11 of a mixed addition. A bucket may only be the target of one
+ *    addition per batch; further points for the same bucket are paired with each other (via a per-bucket spare slot)
+ *    and their sums are fed back into the bucket once the batch is evaluated. Heavily skewed digit distributions (e.g.
+ *    many equal scalars) therefore cost O(log n) batches rather than one batch per point. There is no sort of the
+ *    point schedule.
+ * 3. Work is split into (window, point range) tasks, each with its own bucket array, so threads never share buckets.
+ *    The window width is chosen to minimise the sum of the bucket accumulation and bucket reduction costs for the
+ *    resulting number of tasks.
+ *
+ * Doublings and additions of inverse points inside a bucket are handled, so unlike pippenger_unsafe this is safe to use
+ * with arbitrary (distinct or repeated) input points.
+ *
+ * @param scalars The scalars, indexed relative to the start of `points` via their start_index
+ * @param points The pippenger point table (P_i at index 2i, its endomorphism image at index 2i + 1)
+ */
+template <typename Curve>
+typename Curve::Element pippenger_batch_affine(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                               std::span<const typename Curve::AffineElement> points);
+
+/**
+ * @brief Choose the window width for pippenger_batch_affine given the number of (endomorphism-expanded) points and
+ * threads.
+ */
+size_t get_batch_affine_window_bits(size_t num_points, size_t num_threads);
+
+} // namespace bb::scalar_multiplication
@@ -1048,6 +1048,185 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(
     return pippenger(scalars, G_mod, state, false);
 }
 
+/**
+ * @brief Compute the contribution of a contiguous run of points to an MSM using signed-digit buckets.
+ * @details Single-threaded bucket method over the endomorphism-expanded point table: `split_scalars[i]` multiplies
+ * `points[i]`. Buckets are projective so the mixed addition formulae handle all edge cases.
+ *
+ * @param points Endomorphism-expanded points, aligned with split_scalars
+ * @param split_scalars 128-bit scalars produced by the endomorphism split
+ * @param window_bits Width of a signed window
+ * @param buckets Thread-local bucket storage, resized as required
+ */
+template <typename Curve>
+typename Curve::Element evaluate_tile_msm(std::span<const typename Curve::AffineElement> points,
+                                          std::span<const std::array<uint64_t, 2>> split_scalars,
+                                          const size_t window_bits,
+                                          std::vector<typename Curve::Element>& buckets)
+{
+    using Element = typename Curve::Element;
+
+    const size_t num_buckets = 1UL << (window_bits - 1);
+    const size_t num_windows = get_num_signed_windows(window_bits);
+    buckets.resize(num_buckets);
+
+    Element result;
+    result.self_set_infinity();
+    for (size_t window_idx = num_windows - 1; window_idx < num_windows; --window_idx) {
+        for (size_t k = 0; k < window_bits; ++k) {
+            result.self_dbl();
+        }
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+
+        bool window_is_empty = true;
+        for (size_t i = 0; i < split_scalars.size(); ++i) {
+            const int64_t digit = get_signed_digit(split_scalars[i], window_bits, window_idx);
+            if (digit > 0) {
+                buckets[static_cast<size_t>(digit - 1)] += points[i];
+                window_is_empty = false;
+            } else if (digit < 0) {
+                buckets[static_cast<size_t>(-digit - 1)] += -points[i];
+                window_is_empty = false;
+            }
+        }
+        if (window_is_empty) {
+            continue;
+        }
+
+        // sum_b (b + 1) * bucket[b] via a running sum from the top bucket down
+        Element running_sum;
+        Element window_sum;
+        running_sum.self_set_infinity();
+        window_sum.self_set_infinity();
+        for (size_t b = num_buckets - 1; b < num_buckets; --b) {
+            running_sum += buckets[b];
+            window_sum += running_sum;
+        }
+        result += window_sum;
+    }
+    return result;
+}
+
+/**
+ * @brief Compute many MSMs that share one endomorphism-expanded point table in a single parallel pass.
+ * @details Calling pippenger once per scalar vector pays for a full fork-join schedule (wnaf computation, radix sort,
+ * bucket reduction) and re-streams the point table from memory for every vector. For many small or medium vectors these
+ * fixed costs dominate. Instead, the point index space is cut into tiles of BATCH_MSM_TILE_SIZE points and every
+ * (msm, tile) pair with a nonzero overlap becomes a work unit. Units are ordered tile-major and dealt out to threads in
+ * contiguous, cost-balanced runs, so a thread walks all of the msms touching a tile while that tile of points is hot in
+ * cache, and the whole batch needs one parallel_for rather than several per msm. Each unit is evaluated with the
+ * signed-digit bucket method (see get_signed_digit); the per-tile partial results are summed per msm at the end.
+ *
+ * @note The expected layout of `points` matches that of the prover SRS: the point P_i at index 2i and its endomorphism
+ * image (beta * x, -y) at index 2i + 1.
+ *
+ * @param scalars The scalar vectors, indexed relative to the start of `points` via their start_index
+ * @param points The pippenger point table
+ * @return One (projective) MSM result per scalar vector
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> batch_multi_scalar_mul(
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars,
+    std::span<const typename Curve::AffineElement> points)
+{
+    PROFILE_THIS();
+
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    struct WorkUnit {
+        size_t msm_idx;
+        size_t start; // first (un-expanded) point index of the unit
+        size_t end;
+    };
+
+    // Enumerate the work units, tile-major so that consecutive units reuse the same points
+    size_t max_end_index = 0;
+    for (const auto& msm_scalars : scalars) {
+        max_end_index = std::max(max_end_index, msm_scalars.end_index());
+    }
+    ASSERT(max_end_index * 2 <= points.size());
+    const size_t num_tiles = (max_end_index + BATCH_MSM_TILE_SIZE - 1) / BATCH_MSM_TILE_SIZE;
+
+    std::vector<WorkUnit> work_units;
+    size_t total_cost = 0;
+    for (size_t tile_idx = 0; tile_idx < num_tiles; ++tile_idx) {
+        const size_t tile_start = tile_idx * BATCH_MSM_TILE_SIZE;
+        const size_t tile_end = tile_start + BATCH_MSM_TILE_SIZE;
+        for (size_t msm_idx = 0; msm_idx < scalars.size(); ++msm_idx) {
+            const size_t start = std::max(tile_start, scalars[msm_idx].start_index);
+            const size_t end = std::min(tile_end, scalars[msm_idx].end_index());
+            if (start < end) {
+                work_units.push_back({ msm_idx, start, end });
+                total_cost += end - start;
+            }
+        }
+    }
+
+    // Deal out contiguous runs of units of roughly equal total cost, one run per thread
+    const size_t num_threads = std::max<size_t>(1, std::min(get_num_cpus(), work_units.size()));
+    std::vector<size_t> thread_unit_offsets(num_threads + 1, work_units.size());
+    thread_unit_offsets[0] = 0;
+    {
+        size_t thread_idx = 1;
+        size_t accumulated_cost = 0;
+        for (size_t unit_idx = 0; unit_idx < work_units.size() && thread_idx < num_threads; ++unit_idx) {
+            accumulated_cost += work_units[unit_idx].end - work_units[unit_idx].start;
+            while (thread_idx < num_threads && accumulated_cost * num_threads >= total_cost * thread_idx) {
+                thread_unit_offsets[thread_idx++] = unit_idx + 1;
+            }
+        }
+    }
+
+    std::vector<Element> unit_results(work_units.size());
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        std::vector<std::array<uint64_t, 2>> split_scalars;
+        std::vector<Element> buckets;
+        split_scalars.reserve(2 * BATCH_MSM_TILE_SIZE);
+
+        for (size_t unit_idx = thread_unit_offsets[thread_idx]; unit_idx < thread_unit_offsets[thread_idx + 1];
+             ++unit_idx) {
+            const WorkUnit& unit = work_units[unit_idx];
+            const auto& msm_scalars = scalars[unit.msm_idx];
+            unit_results[unit_idx].self_set_infinity();
+
+            // Endomorphism split of the unit's scalars, interleaved to match the point table layout
+            split_scalars.clear();
+            bool unit_is_zero = true;
+            for (size_t i = unit.start; i < unit.end; ++i) {
+                const Fr& scalar = msm_scalars[i];
+                if (scalar.is_zero()) {
+                    split_scalars.push_back({ 0, 0 });
+                    split_scalars.push_back({ 0, 0 });
+                    continue;
+                }
+                unit_is_zero = false;
+                auto [k1, k2] = Fr::split_into_endomorphism_scalars(scalar.from_montgomery_form());
+                split_scalars.push_back(k1);
+                split_scalars.push_back(k2);
+            }
+            if (unit_is_zero) {
+                continue;
+            }
+
+            const size_t window_bits = get_optimal_bucket_width(split_scalars.size()) + 1;
+            unit_results[unit_idx] = evaluate_tile_msm<Curve>(
+                points.subspan(unit.start * 2, split_scalars.size()), split_scalars, window_bits, buckets);
+        }
+    });
+
+    std::vector<Element> results(scalars.size());
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+    for (size_t unit_idx = 0; unit_idx < work_units.size(); ++unit_idx) {
+        results[work_units[unit_idx].msm_idx] += unit_results[unit_idx];
+    }
+    return results;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(const curve::BN254::AffineElement* points,
@@ -1109,6 +1288,10 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     std::span<const curve::BN254::AffineElement> points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template std::vector<curve::BN254::Element> batch_multi_scalar_mul<curve::BN254>(
+    std::span<const PolynomialSpan<const curve::BN254::ScalarField>> scalars,
+    std::span<const curve::BN254::AffineElement> points);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(const curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1169,6 +1352,10 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     std::span<const curve::Grumpkin::AffineElement> points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template std::vector<curve::Grumpkin::Element> batch_multi_scalar_mul<curve::Grumpkin>(
+    std::span<const PolynomialSpan<const curve::Grumpkin::ScalarField>> scalars,
+    std::span<const curve::Grumpkin::AffineElement> points);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
@@ -4,8 +4,11 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 
@@ -175,6 +178,55 @@ typename Curve::Element pippenger_unsafe_optimized_for_non_dyadic_polys(
     std::span<const typename Curve::AffineElement> points,
     pippenger_runtime_state<Curve>& state);
 
+// Number of (un-expanded) points in a tile of the point table processed by batch_multi_scalar_mul
+constexpr size_t BATCH_MSM_TILE_SIZE = 1UL << 13;
+
+/**
+ * @brief Extract `num_bits` bits of a 128-bit endomorphism-split scalar starting at `bit_position`.
+ * @details Unlike wnaf::get_wnaf_bits, bits beyond the 128th are treated as zero rather than being read from an
+ * adjacent limb, so the top window of a scalar can be read without padding the scalar.
+ */
+inline uint64_t get_scalar_slice(const std::array<uint64_t, 2>& scalar, size_t bit_position, size_t num_bits)
+{
+    if (bit_position >= 128) {
+        return 0;
+    }
+    const size_t limb_idx = bit_position >> 6;
+    const size_t shift = bit_position & 63;
+    uint64_t slice = scalar[limb_idx] >> shift;
+    if (shift != 0 && limb_idx == 0) {
+        slice |= scalar[1] << (64 - shift);
+    }
+    return slice & ((1ULL << num_bits) - 1);
+}
+
+/**
+ * @brief Compute the signed (Booth-recoded) digit of a 128-bit scalar for a window of `window_bits` bits.
+ * @details Digit w is read from the window bits [w*c, w*c + c) together with the bit just below the window:
+ * d_w = slice_w + b_{w*c - 1} - 2^c * b_{w*c + c - 1}. The correction terms telescope across windows, so
+ * sum_w d_w * 2^{w*c} equals the scalar provided the window count covers at least 129 bits (see get_num_signed_windows).
+ * Each digit lies in [-2^{c-1}, 2^{c-1}], so 2^{c-1} buckets suffice, and since every digit only depends on the scalar
+ * (no carry chain) windows can be recoded in any order.
+ */
+inline int64_t get_signed_digit(const std::array<uint64_t, 2>& scalar, size_t window_bits, size_t window_idx)
+{
+    const size_t bit_position = window_idx * window_bits;
+    const uint64_t slice = get_scalar_slice(scalar, bit_position, window_bits);
+    const uint64_t borrow_in = (bit_position == 0) ? 0 : get_scalar_slice(scalar, bit_position - 1, 1);
+    const uint64_t top_bit = slice >> (window_bits - 1);
+    return static_cast<int64_t>(slice + borrow_in) - static_cast<int64_t>(top_bit << window_bits);
+}
+
+constexpr size_t get_num_signed_windows(const size_t window_bits)
+{
+    return (128 / window_bits) + 1;
+}
+
+template <typename Curve>
+std::vector<typename Curve::Element> batch_multi_scalar_mul(
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars,
+    std::span<const typename Curve::AffineElement> points);
+
 // Explicit instantiation
 // BN254
 
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/op_queue/ecc_op_queue.hpp"
 
 namespace bb {
@@ -85,13 +88,9 @@ class ECCVMMSMMBuilder {
 
         const size_t num_rows_in_read_counts_table =
             static_cast<size_t>(total_number_of_muls) * (eccvm::POINT_TABLE_SIZE >> 1);
-        std::array<std::vector<size_t>, 2> point_table_read_counts;
-        point_table_read_counts[0].reserve(num_rows_in_read_counts_table);
-        point_table_read_counts[1].reserve(num_rows_in_read_counts_table);
-        for (size_t i = 0; i < num_rows_in_read_counts_table; ++i) {
-            point_table_read_counts[0].emplace_back(0);
-            point_table_read_counts[1].emplace_back(0);
-        }
+        std::array<std::vector<size_t>, 2> point_table_read_counts{
+            std::vector<size_t>(num_rows_in_read_counts_table, 0), std::vector<size_t>(num_rows_in_read_counts_table, 0)
+        };
 
         const auto update_read_count = [&point_table_read_counts](const size_t point_idx, const int slice) {
             /**
@@ -130,6 +129,22 @@ class ECCVMMSMMBuilder {
         }
         ASSERT(pc_values.back() == 0);
 
+        // The MSMs are independent of each other: every MSM starts its accumulator at the offset generator, writes its
+        // own range of rows (and of the point trace) and reads from its own range of point tables. They are therefore
+        // processed in parallel. As MSM sizes vary widely, the threads are given ranges of rows rather than ranges of
+        // MSMs, each MSM being processed by the thread whose range contains its first row.
+        const auto for_each_msm_in_parallel = [&](const std::function<void(size_t)>& func) {
+            const auto msm_starts_begin = msm_row_counts.begin();
+            const auto msm_starts_end = msm_row_counts.end() - 1;
+            parallel_for_range(msm_row_counts.back(), [&](size_t start_row, size_t end_row) {
+                const auto first = std::lower_bound(msm_starts_begin, msm_starts_end, start_row);
+                const auto last = std::lower_bound(msm_starts_begin, msm_starts_end, end_row);
+                for (auto it = first; it != last; ++it) {
+                    func(static_cast<size_t>(it - msm_starts_begin));
+                }
+            });
+        };
+
         // compute the MSM rows
 
         std::vector<MSMRow> msm_rows(num_msm_rows);
@@ -137,9 +152,8 @@ class ECCVMMSMMBuilder {
         msm_rows[0] = (MSMRow{});
         // compute "read counts" so that we can determine the number of times entries in our log-derivative lookup
         // tables are called.
-        // Note: this part is single-threaded. The amount of compute is low, however, so this is likely not a big
-        // concern.
-        for (size_t msm_idx = 0; msm_idx < msms.size(); ++msm_idx) {
+        // Note: the read counts of a point only depend on its own wNAF digits, so the MSMs update disjoint entries.
+        for_each_msm_in_parallel([&](size_t msm_idx) {
             for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
                 auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
                 const auto& msm = msms[msm_idx];
@@ -182,7 +196,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // The execution trace data for the MSM columns requires knowledge of intermediate values from *affine* point
         // addition. The naive solution to compute this data requires 2 field inversions per in-circuit group addition
@@ -204,7 +218,8 @@ class ECCVMMSMMBuilder {
         std::span<Element> p2_trace(&points_to_normalize[num_point_adds_and_doubles], num_point_adds_and_doubles);
         std::span<Element> p3_trace(&points_to_normalize[num_point_adds_and_doubles * 2], num_point_adds_and_doubles);
         // operation_trace records whether an entry in the p1/p2/p3 trace represents a point addition or doubling
-        std::vector<bool> operation_trace(num_point_adds_and_doubles);
+        // (not a std::vector<bool>, whose entries can't be written concurrently)
+        std::vector<uint8_t> operation_trace(num_point_adds_and_doubles);
         // accumulator_trace tracks the value of the ECCVM accumulator for each row
         std::span<Element> accumulator_trace(&points_to_normalize[num_point_adds_and_doubles * 3], num_accumulators);
 
@@ -212,10 +227,9 @@ class ECCVMMSMMBuilder {
         constexpr auto offset_generator = bb::g1::derive_generators("ECCVM_OFFSET_GENERATOR", 1)[0];
         accumulator_trace[0] = offset_generator;
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/973): Reinstate multitreading?
         // populate point trace, and the components of the MSM execution trace that do not relate to affine point
         // operations
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        for_each_msm_in_parallel([&](size_t msm_idx) {
             Element accumulator = offset_generator;
             const auto& msm = msms[msm_idx];
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -259,7 +273,7 @@ class ECCVMMSMMBuilder {
                         p1_trace[trace_index] = p1;
                         p2_trace[trace_index] = p2;
                         p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = false;
+                        operation_trace[trace_index] = 0;
                         trace_index++;
                     }
                     accumulator_trace[msm_row_index] = accumulator;
@@ -293,7 +307,7 @@ class ECCVMMSMMBuilder {
                         p2_trace[trace_index] = accumulator;
                         accumulator = accumulator.dbl();
                         p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = true;
+                        operation_trace[trace_index] = 1;
                         trace_index++;
                     }
                     accumulator_trace[msm_row_index] = accumulator;
@@ -323,7 +337,7 @@ class ECCVMMSMMBuilder {
                             p1_trace[trace_index] = p1;
                             p2_trace[trace_index] = add_state.point;
                             p3_trace[trace_index] = accumulator;
-                            operation_trace[trace_index] = false;
+                            operation_trace[trace_index] = 0;
                             trace_index++;
                         }
                         row.q_add = false;
@@ -338,7 +352,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // Normalize the points in the point trace
         parallel_for_range(points_to_normalize.size(), [&](size_t start, size_t end) {
@@ -361,7 +375,7 @@ class ECCVMMSMMBuilder {
         // complete the computation of the ECCVM execution trace, by adding the affine intermediate point data
         // i.e. row.accumulator_x, row.accumulator_y, row.add_state[0...3].collision_inverse,
         // row.add_state[0...3].lambda
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        for_each_msm_in_parallel([&](size_t msm_idx) {
             const auto& msm = msms[msm_idx];
             size_t trace_index = ((msm_row_counts[msm_idx] - 1) * ADDITIONS_PER_ROW);
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -433,7 +447,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // populate the final row in the MSM execution trace.
         // we always require 1 extra row at the end of the trace, because the accumulator x/y coordinates for row `i`
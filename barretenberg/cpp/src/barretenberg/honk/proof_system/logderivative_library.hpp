@@ -1,7 +1,10 @@
 #pragma once
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
 
+#include <algorithm>
+#include <span>
 #include <typeinfo>
 
 namespace bb {
@@ -24,6 +27,11 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The rows are split into chunks that are processed in parallel. Each chunk batch-inverts its own rows, so the whole
+ * computation scales with the number of threads at the cost of one field inversion per chunk, and chunks without any
+ * lookup operation are not inverted at all. Rows are accessed through polynomials.get_row(), so flavors with a lazy
+ * row proxy (e.g. the AVM) only read the columns the relation touches.
+ *
  */
 template <typename FF, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
@@ -31,32 +39,48 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     using Accumulator = typename Relation::ValueAccumulator0;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
+    // Keeps the cost of the per chunk inversion negligible.
+    constexpr size_t MIN_ROWS_PER_CHUNK = 1 << 10;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = Relation::operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
+    const size_t num_chunks = std::clamp<size_t>(circuit_size / MIN_ROWS_PER_CHUNK, 1, 4 * get_num_cpus());
+    const size_t rows_per_chunk = (circuit_size + num_chunks - 1) / num_chunks;
+
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        const size_t start = chunk_idx * rows_per_chunk;
+        const size_t end = std::min(start + rows_per_chunk, circuit_size);
+        size_t first_active_row = end;
+        size_t last_active_row = start;
+        for (size_t i = start; i < end; ++i) {
+            // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+            auto row = polynomials.get_row(i);
+            bool has_inverse = Relation::operation_exists_at_row(row);
+            if (!has_inverse) {
+                continue;
+            }
+            FF denominator = 1;
+            bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                auto denominator_term =
+                    Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                auto denominator_term =
+                    Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            inverse_polynomial.at(i) = denominator;
+            first_active_row = std::min(first_active_row, i);
+            last_active_row = i;
+        }
+
+        // Compute the inverses of this chunk in place by inverting the product at each active row
+        // Note: zeroes are ignored as they are not used anyway
+        if (first_active_row < end) {
+            const size_t num_rows = last_active_row - first_active_row + 1;
+            FF::batch_invert(std::span{ &inverse_polynomial.at(first_active_row), num_rows });
         }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial.at(i) = denominator;
-    };
-
-    // Compute inverse polynomial I in place by inverting the product at each row
-    // Note: zeroes are ignored as they are not used anyway
-    FF::batch_invert(inverse_polynomial.coeffs());
+    });
 }
 
 /**
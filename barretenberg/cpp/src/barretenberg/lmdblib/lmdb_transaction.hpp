@@ -56,6 +56,12 @@ class LMDBTransaction {
 
     template <typename T> bool get_value(T& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    /*
+     * Points data at the value inside the memory map rather than copying it out.
+     * The value is only valid until the transaction ends or (for write transactions) the next write.
+     */
+    template <typename T> bool get_value(T& key, MDB_val& data, const LMDBDatabase& db) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -70,6 +76,8 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    bool get_value(std::vector<uint8_t>& key, MDB_val& data, const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
@@ -89,6 +97,12 @@ template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, co
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T> bool LMDBTransaction::get_value(T& key, MDB_val& data, const LMDBDatabase& db) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    return get_value(keyBuffer, data, db);
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
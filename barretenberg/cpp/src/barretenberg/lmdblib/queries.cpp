@@ -114,6 +114,15 @@ bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const bb::lmdbl
     return true;
 }
 
+bool get_value(Key& key, MDB_val& data, const LMDBDatabase& db, const bb::lmdblib::LMDBTransaction& tx)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    return call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &dbKey, &data);
+}
+
 bool set_at_key(const LMDBCursor& cursor, Key& key)
 {
     MDB_val dbKey;
@@ -182,6 +182,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_SIBLING_PATH,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_path(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::GET_SIBLING_PATHS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_paths(obj, buffer); });
+
     _dispatcher.register_target(WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES,
                                 [this](msgpack::object& obj, msgpack::sbuffer& buffer) {
                                     return get_block_numbers_for_leaf_indices(obj, buffer);
@@ -207,6 +211,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::SEQUENTIAL_INSERT,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sequential_insert(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::INSERT_BLOCK_SIDE_EFFECTS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return insert_block_side_effects(obj, buffer); });
+
     _dispatcher.register_target(
         WorldStateMessageType::UPDATE_ARCHIVE,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return update_archive(obj, buffer); });
@@ -222,6 +230,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::SYNC_BLOCK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_block(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::SYNC_BLOCKS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_blocks(obj, buffer); });
+
     _dispatcher.register_target(
         WorldStateMessageType::CREATE_FORK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return create_fork(obj, buffer); });
@@ -440,6 +452,23 @@ bool WorldStateWrapper::get_sibling_path(msgpack::object& obj, msgpack::sbuffer&
     return true;
 }
 
+bool WorldStateWrapper::get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetSiblingPathsRequest> request;
+    obj.convert(request);
+
+    std::vector<fr_sibling_path> paths =
+        _ws->get_sibling_paths(request.value.revision, request.value.treeId, request.value.leafIndices);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<std::vector<fr_sibling_path>> resp_msg(
+        WorldStateMessageType::GET_SIBLING_PATHS, header, paths);
+
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const
 {
     TypedMessage<GetBlockNumbersForLeafIndicesRequest> request;
@@ -623,6 +652,22 @@ bool WorldStateWrapper::sequential_insert(msgpack::object& obj, msgpack::sbuffer
     return true;
 }
 
+bool WorldStateWrapper::insert_block_side_effects(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    TypedMessage<InsertBlockSideEffectsRequest> request;
+    obj.convert(request);
+
+    BlockInsertionResult result =
+        _ws->insert_block_side_effects(request.value.paddedL1ToL2Messages, request.value.txs, request.value.forkId);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<BlockInsertionResult> resp_msg(
+        WorldStateMessageType::INSERT_BLOCK_SIDE_EFFECTS, header, result);
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::update_archive(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<UpdateArchiveRequest> request;
@@ -685,6 +730,30 @@ bool WorldStateWrapper::sync_block(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+bool WorldStateWrapper::sync_blocks(msgpack::object& obj, msgpack::sbuffer& buf)
+{
+    TypedMessage<SyncBlocksRequest> request;
+    obj.convert(request);
+
+    std::vector<SyncBlockData> blocks;
+    blocks.reserve(request.value.blocks.size());
+    for (auto& block : request.value.blocks) {
+        blocks.push_back({ .block_state_ref = std::move(block.blockStateRef),
+                           .block_header_hash = block.blockHeaderHash,
+                           .notes = std::move(block.paddedNoteHashes),
+                           .l1_to_l2_messages = std::move(block.paddedL1ToL2Messages),
+                           .nullifiers = std::move(block.paddedNullifiers),
+                           .public_writes = std::move(block.publicDataWrites) });
+    }
+    WorldStateStatusFull status = _ws->sync_blocks(blocks);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<WorldStateStatusFull> resp_msg(WorldStateMessageType::SYNC_BLOCKS, header, { status });
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::create_fork(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<CreateForkRequest> request;
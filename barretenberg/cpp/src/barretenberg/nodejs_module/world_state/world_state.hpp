@@ -38,6 +38,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool get_leaf_value(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_leaf_preimage(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_sibling_path(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool find_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -46,6 +47,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool append_leaves(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool batch_insert(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool sequential_insert(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool insert_block_side_effects(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool update_archive(msgpack::object& obj, msgpack::sbuffer& buffer);
 
@@ -53,6 +55,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool rollback(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool sync_block(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool sync_blocks(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool create_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool delete_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -54,6 +54,11 @@ enum WorldStateMessageType {
 
     COPY_STORES,
 
+    INSERT_BLOCK_SIDE_EFFECTS,
+    SYNC_BLOCKS,
+
+    GET_SIBLING_PATHS,
+
     CLOSE = 999,
 };
 
@@ -144,6 +149,13 @@ struct GetSiblingPathRequest {
     MSGPACK_FIELDS(treeId, revision, leafIndex);
 };
 
+struct GetSiblingPathsRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<index_t> leafIndices;
+    MSGPACK_FIELDS(treeId, revision, leafIndices);
+};
+
 struct GetBlockNumbersForLeafIndicesRequest {
     MerkleTreeId treeId;
     WorldStateRevision revision;
@@ -233,6 +245,18 @@ struct SyncBlockRequest {
                    publicDataWrites);
 };
 
+struct SyncBlocksRequest {
+    std::vector<SyncBlockRequest> blocks;
+    MSGPACK_FIELDS(blocks);
+};
+
+struct InsertBlockSideEffectsRequest {
+    std::vector<bb::fr> paddedL1ToL2Messages;
+    std::vector<TxSideEffects> txs;
+    Fork::Id forkId{ CANONICAL_FORK_ID };
+    MSGPACK_FIELDS(paddedL1ToL2Messages, txs, forkId);
+};
+
 struct CopyStoresRequest {
     std::string dstPath;
     std::optional<bool> compact;
@@ -79,28 +79,29 @@ std::array<typename Flavor::Polynomial, 4> construct_sorted_list_polynomials(typ
 
     for (auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
+        const auto& basic_table = *table.table;
         auto& lookup_gates = table.lookup_gates;
         for (size_t i = 0; i < table.size(); ++i) {
-            if (table.use_twin_keys) {
+            if (basic_table.use_twin_keys) {
                 lookup_gates.push_back({
                     {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
+                        basic_table.column_1[i].from_montgomery_form().data[0],
+                        basic_table.column_2[i].from_montgomery_form().data[0],
                     },
                     {
-                        table.column_3[i],
+                        basic_table.column_3[i],
                         0,
                     },
                 });
             } else {
                 lookup_gates.push_back({
                     {
-                        table.column_1[i].from_montgomery_form().data[0],
+                        basic_table.column_1[i].from_montgomery_form().data[0],
                         0,
                     },
                     {
-                        table.column_2[i],
-                        table.column_3[i],
+                        basic_table.column_2[i],
+                        basic_table.column_3[i],
                     },
                 });
             }
@@ -113,7 +114,7 @@ std::array<typename Flavor::Polynomial, 4> construct_sorted_list_polynomials(typ
 #endif
 
         for (const auto& entry : lookup_gates) {
-            const auto components = entry.to_table_components(table.use_twin_keys);
+            const auto components = entry.to_table_components(basic_table.use_twin_keys);
             sorted_polynomials[0][s_index] = components[0];
             sorted_polynomials[1][s_index] = components[1];
             sorted_polynomials[2][s_index] = components[2];
@@ -2,8 +2,10 @@
 #include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/polynomial_store.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/plookup_tables.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
 
+#include <algorithm>
 #include <memory>
 
 namespace bb {
@@ -29,16 +31,17 @@ void construct_lookup_table_polynomials(const RefArray<typename Flavor::Polynomi
         offset = circuit.blocks.lookup.trace_offset + additional_offset;
     }
 
-    for (const auto& table : circuit.lookup_tables) {
-        const fr table_index(table.table_index);
+    if (tables_size == 0) {
+        return;
+    }
 
-        for (size_t i = 0; i < table.size(); ++i) {
-            table_polynomials[0].at(offset) = table.column_1[i];
-            table_polynomials[1].at(offset) = table.column_2[i];
-            table_polynomials[2].at(offset) = table.column_3[i];
-            table_polynomials[3].at(offset) = table_index;
-            ++offset;
-        }
+    // The column values only depend on the tables of the circuit, so they are shared by all proving keys of circuits
+    // with the same tables and copied in as a whole
+    const auto columns = plookup::get_table_columns(circuit.lookup_tables);
+    ASSERT(columns->at(0).size() == tables_size);
+    for (size_t i = 0; i < 4; ++i) {
+        const auto& column = columns->at(i);
+        std::copy(column.begin(), column.end(), &table_polynomials[i].at(offset));
     }
 }
 
@@ -59,15 +62,16 @@ void construct_lookup_read_counts(typename Flavor::Polynomial& read_counts,
     size_t table_offset = circuit.blocks.lookup.trace_offset;
 
     // loop over all tables used in the circuit; each table contains data about the lookups made on it
-    for (auto& table : circuit.lookup_tables) {
-        table.initialize_index_map();
+    for (const auto& table : circuit.lookup_tables) {
+        // The index map of a basic table is built once, when the table is first generated
+        const auto& basic_table = *table.table;
 
-        for (auto& gate_data : table.lookup_gates) {
+        for (const auto& gate_data : table.lookup_gates) {
             // convert lookup gate data to an array of three field elements, one for each of the 3 columns
-            auto table_entry = gate_data.to_table_components(table.use_twin_keys);
+            auto table_entry = gate_data.to_table_components(basic_table.use_twin_keys);
 
             // find the index of the entry in the table
-            auto index_in_table = table.index_map[table_entry];
+            auto index_in_table = basic_table.index_map[table_entry];
 
             // increment the read count at the corresponding index in the full polynomial
             size_t index_in_poly = table_offset + index_in_table;
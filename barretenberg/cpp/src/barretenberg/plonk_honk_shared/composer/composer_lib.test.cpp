@@ -79,4 +79,56 @@ TEST_F(ComposerLibTests, LookupReadCounts)
         }
         idx++;
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief The table polynomials hold the columns of the tables of the circuit, which are built once for all proving keys
+ * of circuits using the same tables
+ */
+TEST_F(ComposerLibTests, LookupTablePolynomials)
+{
+    using Builder = UltraCircuitBuilder;
+    using Polynomial = typename Flavor::Polynomial;
+
+    const FF left{ 1 };
+    const FF right{ 5 };
+    auto add_lookup = [&](Builder& builder, const plookup::MultiTableId id) {
+        const auto accumulators = plookup::get_lookup_accumulators(id, left, right, /*is_2_to_1_lookup*/ true);
+        builder.create_gates_from_plookup_accumulators(
+            id, accumulators, builder.add_variable(left), builder.add_variable(right));
+    };
+
+    Builder builder;
+    add_lookup(builder, plookup::MultiTableId::UINT32_XOR);
+    Builder same_tables;
+    add_lookup(same_tables, plookup::MultiTableId::UINT32_XOR);
+    add_lookup(same_tables, plookup::MultiTableId::UINT32_XOR);
+    Builder other_tables;
+    add_lookup(other_tables, plookup::MultiTableId::UINT32_AND);
+    add_lookup(other_tables, plookup::MultiTableId::UINT32_XOR);
+
+    const auto columns = plookup::get_table_columns(builder.lookup_tables);
+    EXPECT_EQ(columns, plookup::get_table_columns(same_tables.lookup_tables));
+    EXPECT_NE(columns, plookup::get_table_columns(other_tables.lookup_tables));
+
+    const size_t circuit_size = 8192;
+    std::array<Polynomial, 4> table_polynomials;
+    for (auto& poly : table_polynomials) {
+        poly = Polynomial(circuit_size);
+    }
+    construct_lookup_table_polynomials<Flavor>(
+        { table_polynomials[0], table_polynomials[1], table_polynomials[2], table_polynomials[3] },
+        builder,
+        circuit_size);
+
+    size_t offset = builder.blocks.lookup.trace_offset;
+    for (const auto& table : builder.lookup_tables) {
+        for (size_t i = 0; i < table.size(); ++i) {
+            EXPECT_EQ(table_polynomials[0][offset], table.table->column_1[i]);
+            EXPECT_EQ(table_polynomials[1][offset], table.table->column_2[i]);
+            EXPECT_EQ(table_polynomials[2][offset], table.table->column_3[i]);
+            EXPECT_EQ(table_polynomials[3][offset], FF(table.table_index));
+            ++offset;
+        }
+    }
+    EXPECT_EQ(table_polynomials[0][offset], FF(0));
+}
@@ -122,6 +122,36 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
 using CyclicPermutation = std::vector<cycle_node>;
 
 namespace {
+/**
+ * @brief Call func(cycle_idx, node_idx) for every node of every copy cycle, spreading the nodes evenly over threads
+ *
+ * @details Every wire position belongs to at most one copy cycle, so func can write to the position of its node
+ * without synchronization. Splitting by nodes rather than by cycles keeps the threads balanced even when a few
+ * cycles (e.g. the one of the zero variable) are very long.
+ */
+template <typename Func>
+void parallel_for_each_cycle_node(const std::vector<CyclicPermutation>& wire_copy_cycles, const Func& func)
+{
+    std::vector<size_t> cycle_offsets(wire_copy_cycles.size() + 1, 0);
+    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
+        cycle_offsets[cycle_idx + 1] = cycle_offsets[cycle_idx] + wire_copy_cycles[cycle_idx].size();
+    }
+    parallel_for_range(cycle_offsets.back(), [&](size_t start, size_t end) {
+        if (start == end) {
+            return;
+        }
+        // The last cycle starting at or before start, which skips empty cycles
+        auto cycle_idx = static_cast<size_t>(
+            std::upper_bound(cycle_offsets.begin(), cycle_offsets.end(), start) - cycle_offsets.begin() - 1);
+        for (size_t node = start; node < end; ++cycle_idx) {
+            const size_t cycle_end = std::min(end, cycle_offsets[cycle_idx + 1]);
+            for (; node < cycle_end; ++node) {
+                func(cycle_idx, node - cycle_offsets[cycle_idx]);
+            }
+        }
+    });
+}
+
 /**
  * @brief Compute the traditional or generalized permutation mapping
  *
@@ -148,42 +178,40 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
     // Go through each cycle
-    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
+    parallel_for_each_cycle_node(wire_copy_cycles, [&](size_t cycle_idx, size_t node_idx) {
         const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
-        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
-            // Get the indices (column, row) of the current node in the cycle
-            const cycle_node& current_node = cycle[node_idx];
-            const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
-            const auto current_column = current_node.wire_idx;
-
-            // Get indices of next node; If the current node is last in the cycle, then the next is the first one
-            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_node = cycle[next_node_idx];
-            const auto next_row = next_node.gate_idx;
-            const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
-
-            // Point current node to the next node
-            mapping.sigmas[current_column].row_idx[current_row] = next_row;
-            mapping.sigmas[current_column].col_idx[current_row] = next_column;
-
-            if constexpr (generalized) {
-                const bool first_node = (node_idx == 0);
-                const bool last_node = (next_node_idx == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column].is_tag[current_row] = true;
-                    mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column].is_tag[current_row] = true;
+        // Get the indices (column, row) of the current node in the cycle
+        const cycle_node& current_node = cycle[node_idx];
+        const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
+        const auto current_column = current_node.wire_idx;
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column].row_idx[current_row] =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
-                }
+        // Get indices of next node; If the current node is last in the cycle, then the next is the first one
+        size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+        const cycle_node& next_node = cycle[next_node_idx];
+        const auto next_row = next_node.gate_idx;
+        const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
+
+        // Point current node to the next node
+        mapping.sigmas[current_column].row_idx[current_row] = next_row;
+        mapping.sigmas[current_column].col_idx[current_row] = next_column;
+
+        if constexpr (generalized) {
+            const bool first_node = (node_idx == 0);
+            const bool last_node = (next_node_idx == 0);
+
+            if (first_node) {
+                mapping.ids[current_column].is_tag[current_row] = true;
+                mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
+            }
+            if (last_node) {
+                mapping.sigmas[current_column].is_tag[current_row] = true;
+
+                // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
+                mapping.sigmas[current_column].row_idx[current_row] =
+                    circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
             }
         }
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -264,6 +292,70 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
         wire_idx++;
     }
 }
+
+/**
+ * @brief Compute Honk-style (generalized) sigma and id polynomials directly from the copy cycles
+ *
+ * @details Produces the same polynomials as compute_permutation_mapping followed by
+ * compute_honk_style_permutation_lagrange_polynomials_from_mapping, but writes the final field values right away
+ * instead of materializing a PermutationMapping first, and processes the copy cycles in parallel.
+ */
+template <typename Flavor>
+void compute_honk_style_permutation_polynomials(const typename Flavor::CircuitBuilder& circuit_constructor,
+                                                typename Flavor::ProvingKey* proving_key,
+                                                const std::vector<CyclicPermutation>& wire_copy_cycles)
+{
+    using FF = typename Flavor::FF;
+    const size_t num_gates = proving_key->circuit_size;
+    // Tags are mapped to values disjoint from the ones of wire positions
+    const size_t tag_offset = num_gates * Flavor::NUM_WIRES;
+    auto sigmas = proving_key->polynomials.get_sigmas();
+    auto ids = proving_key->polynomials.get_ids();
+
+    // Initialize every position to point to itself
+    const MultithreadData thread_data = calculate_thread_data(proving_key->active_region_data.size());
+    parallel_for(thread_data.num_threads, [&](size_t j) {
+        for (size_t i = thread_data.start[j]; i < thread_data.end[j]; ++i) {
+            const size_t poly_idx = proving_key->active_region_data.get_idx(i);
+            for (size_t wire_idx = 0; wire_idx < Flavor::NUM_WIRES; ++wire_idx) {
+                const FF self(poly_idx + num_gates * wire_idx);
+                sigmas[wire_idx].at(poly_idx) = self;
+                ids[wire_idx].at(poly_idx) = self;
+            }
+        }
+    });
+
+    // Point each node of a cycle to the next one. The first node of a cycle gets the tag of the variable as its id and
+    // the last node points to the tag's image under tau.
+    std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
+    parallel_for_each_cycle_node(wire_copy_cycles, [&](size_t cycle_idx, size_t node_idx) {
+        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
+        const cycle_node& current_node = cycle[node_idx];
+        const size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+        const cycle_node& next_node = cycle[next_node_idx];
+
+        if (next_node_idx == 0) {
+            sigmas[current_node.wire_idx].at(current_node.gate_idx) =
+                FF(tag_offset + circuit_constructor.tau.at(real_variable_tags[cycle_idx]));
+        } else {
+            sigmas[current_node.wire_idx].at(current_node.gate_idx) =
+                FF(next_node.gate_idx + num_gates * next_node.wire_idx);
+        }
+        if (node_idx == 0) {
+            ids[current_node.wire_idx].at(current_node.gate_idx) = FF(tag_offset + real_variable_tags[cycle_idx]);
+        }
+    });
+
+    // Break the cycles of the public inputs, see compute_honk_style_permutation_lagrange_polynomials_from_mapping
+    const size_t num_public_inputs = circuit_constructor.public_inputs.size();
+    for (size_t i = 0; i < num_public_inputs; ++i) {
+        const size_t idx = i + proving_key->pub_inputs_offset;
+        if (uint256_t(sigmas[0][idx]) >= tag_offset) {
+            std::cerr << "MAPPING IS BOTH A TAG AND A PUBLIC INPUT" << std::endl;
+        }
+        sigmas[0].at(idx) = -FF(idx + 1);
+    }
+}
 } // namespace
 
 /**
@@ -423,9 +515,9 @@ void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuil
                                               const std::vector<CyclicPermutation>& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkOrHonk<Flavor>;
-    auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
 
     if constexpr (IsPlonkFlavor<Flavor>) { // any Plonk flavor
+        auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
         // Compute Plonk-style sigma and ID polynomials in lagrange, monomial, and coset-fft forms
         compute_plonk_permutation_lagrange_polynomials_from_mapping("sigma", mapping.sigmas, key);
         compute_monomial_and_coset_fft_polynomials_from_lagrange<Flavor::NUM_WIRES>("sigma", key);
@@ -434,21 +526,9 @@ void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuil
             compute_monomial_and_coset_fft_polynomials_from_lagrange<Flavor::NUM_WIRES>("id", key);
         }
     } else if constexpr (IsUltraFlavor<Flavor>) { // any UltraHonk flavor
-        // Compute Honk-style sigma and ID polynomials from the corresponding mappings
-        {
+        PROFILE_THIS_NAME("compute_honk_style_permutation_polynomials");
 
-            PROFILE_THIS_NAME("compute_honk_style_permutation_lagrange_polynomials_from_mapping");
-
-            compute_honk_style_permutation_lagrange_polynomials_from_mapping<Flavor>(
-                key->polynomials.get_sigmas(), mapping.sigmas, key);
-        }
-        {
-
-            PROFILE_THIS_NAME("compute_honk_style_permutation_lagrange_polynomials_from_mapping");
-
-            compute_honk_style_permutation_lagrange_polynomials_from_mapping<Flavor>(
-                key->polynomials.get_ids(), mapping.ids, key);
-        }
+        compute_honk_style_permutation_polynomials<Flavor>(circuit, key, copy_cycles);
     }
 }
 
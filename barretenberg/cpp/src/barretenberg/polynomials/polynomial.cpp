@@ -2,6 +2,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_vector.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
@@ -125,6 +126,18 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     memcpy(static_cast<void*>(data()), static_cast<const void*>(coefficients.data()), sizeof(Fr) * coefficients.size());
 }
 
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory,
+                           size_t size,
+                           size_t virtual_size,
+                           size_t start_index)
+{
+    ASSERT(start_index + size <= virtual_size);
+    coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{ start_index, size + start_index, virtual_size,
+                                                         std::move(backing_memory) };
+}
+
 // Assignments
 
 // full copy "expensive" assignment
@@ -175,9 +188,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(PolynomialSpan
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread + other.start_index;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += other[i];
-        }
+        field_vector::add<Fr>(coeffs().subspan(offset - start_index(), end - offset),
+                              other.span.subspan(offset - other.start_index, end - offset));
     });
     return *this;
 }
@@ -264,9 +276,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(PolynomialSpan
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) -= other[i];
-        }
+        field_vector::sub<Fr>(coeffs().subspan(offset - start_index(), end - offset),
+                              other.span.subspan(offset - other.start_index, end - offset));
     });
     return *this;
 }
@@ -279,9 +290,7 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            data()[i] *= scaling_factor;
-        }
+        field_vector::scale<Fr>(coeffs().subspan(offset, end - offset), scaling_factor);
     });
 
     return *this;
@@ -335,9 +344,9 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(PolynomialSpan<const Fr>
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += scaling_factor * other[i];
-        }
+        field_vector::add_scaled<Fr>(coeffs().subspan(offset - start_index(), end - offset),
+                                     other.span.subspan(offset - other.start_index, end - offset),
+                                     scaling_factor);
     });
 }
 
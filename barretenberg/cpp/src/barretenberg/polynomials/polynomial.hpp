@@ -92,6 +92,14 @@ template <typename Fr> class Polynomial {
         : Polynomial(coefficients, coefficients.size())
     {}
 
+    /**
+     * @brief Adopt existing memory as the backing memory of the polynomial, without copying it.
+     *
+     * @param backing_memory Must hold at least `size` elements. Element 0 corresponds to index `start_index`.
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size, size_t start_index = 0);
+
     /**
      * @brief Utility to efficiently construct a shift from the original polynomial.
      *
@@ -7,8 +7,209 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace bb::srs::factories {
+namespace {
+
+#ifndef __wasm__
+/**
+ * @brief Header of a point table cache file. It is followed by num_elements affine elements: the pippenger point table
+ * of the first num_points SRS points (P_i at even and the endomorphism point at odd indices) followed by zeroed
+ * prefetch overflow. Elements are stored in memory layout, i.e. native endianness and Montgomery form.
+ */
+struct PointTableCacheHeader {
+    static constexpr std::array<char, 8> MAGIC = { 'B', 'B', 'P', 'T', 'A', 'B', '0', '1' };
+
+    std::array<char, 8> magic;
+    uint64_t num_points;
+    uint64_t num_elements;
+    uint64_t element_size;
+    // Pads the header to 64 bytes, so that the elements that follow keep their alignment.
+    std::array<uint64_t, 4> reserved;
+};
+static_assert(sizeof(PointTableCacheHeader) == 64);
+
+struct MappedFile {
+    void* data = nullptr;
+    size_t size = 0;
+    MappedFile(void* data, size_t size)
+        : data(data)
+        , size(size)
+    {}
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { munmap(data, size); }
+};
+
+template <typename Curve> struct MappedPointTable {
+    size_t num_points = 0;
+    // Aliases the mapping, which is released with the last user.
+    std::shared_ptr<typename Curve::AffineElement[]> table;
+};
+
+// Number of points of a point table cache that are compared with the transcript before the cache is used
+constexpr size_t NUM_POINT_TABLE_CACHE_SAMPLES = 32;
+
+/**
+ * @brief Compares a sample of the points of a mapped point table cache with the transcript in dir
+ * @details Checks the first and the last point of the cache and of the requested range, and points at random indices.
+ * Catches caches built from a different SRS as well as corrupted ones, without paging in the whole cache.
+ */
+template <typename Curve>
+bool point_table_matches_transcript(const typename Curve::AffineElement* table,
+                                    size_t num_cached_points,
+                                    size_t num_points,
+                                    std::string const& dir)
+{
+    using AffineElement = typename Curve::AffineElement;
+    std::vector<size_t> indices = { 0, num_points - 1, num_cached_points - 1 };
+    auto& engine = numeric::get_randomness();
+    while (indices.size() < NUM_POINT_TABLE_CACHE_SAMPLES) {
+        indices.push_back(static_cast<size_t>(engine.get_random_uint64() % num_cached_points));
+    }
+    for (const size_t index : indices) {
+        const AffineElement point = srs::IO<Curve>::read_transcript_g1_point(index, dir);
+        std::array<AffineElement, 2> expected;
+        scalar_multiplication::generate_pippenger_point_table<Curve>(&point, expected.data(), 1);
+        if (table[2 * index] != expected[0] || table[2 * index + 1] != expected[1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Maps the point table cache at cache_path if it is valid and holds at least num_points points.
+ * @details A sample of the points is compared with the transcript to detect caches that were built from a different
+ * SRS or got corrupted.
+ */
+template <typename Curve>
+MappedPointTable<Curve> map_point_table_cache(std::string const& cache_path, std::string const& dir, size_t num_points)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const int fd = open(cache_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {};
+    }
+    PointTableCacheHeader header{};
+    struct stat st {};
+    const bool header_ok = fstat(fd, &st) == 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                           header.magic == PointTableCacheHeader::MAGIC &&
+                           header.element_size == sizeof(AffineElement) && header.num_points >= num_points &&
+                           header.num_elements >= scalar_multiplication::point_table_size(num_points);
+    const size_t expected_size = sizeof(header) + header.num_elements * sizeof(AffineElement);
+    if (!header_ok || static_cast<size_t>(st.st_size) != expected_size) {
+        close(fd);
+        return {};
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    void* data = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return {};
+    }
+    auto mapping = std::make_shared<MappedFile>(data, file_size);
+    auto* table = reinterpret_cast<AffineElement*>(static_cast<char*>(data) + sizeof(header));
+
+    if (!point_table_matches_transcript<Curve>(table, header.num_points, num_points, dir)) {
+        vinfo("Ignoring ", Curve::name, " point table cache ", cache_path, ", it does not match the transcript");
+        return {};
+    }
+    return { header.num_points, std::shared_ptr<AffineElement[]>(mapping, table) };
+}
+
+/**
+ * @brief Writes a point table cache file. Writes to a temporary file that is renamed into place, so concurrent readers
+ * (and writers) in other processes never observe a partial file.
+ */
+template <typename Curve>
+bool write_point_table_cache(std::string const& cache_path,
+                             const typename Curve::AffineElement* table,
+                             size_t num_points)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_elements = scalar_multiplication::point_table_size(num_points);
+    PointTableCacheHeader header{};
+    header.magic = PointTableCacheHeader::MAGIC;
+    header.num_points = num_points;
+    header.num_elements = num_elements;
+    header.element_size = sizeof(AffineElement);
+
+    const std::string tmp_path = format(cache_path, ".tmp.", getpid());
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    const size_t table_size = 2 * num_points * sizeof(AffineElement);
+    file.write(reinterpret_cast<const char*>(table), static_cast<std::streamsize>(table_size));
+    const std::vector<char> overflow((num_elements - 2 * num_points) * sizeof(AffineElement), 0);
+    file.write(overflow.data(), static_cast<std::streamsize>(overflow.size()));
+    file.close();
+    if (!file || std::rename(tmp_path.c_str(), cache_path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns a point table for at least num_points points from the cache, creating or growing the cache if needed.
+ * Tables are shared by all provers of the process as long as one of them holds on to it.
+ */
+template <typename Curve>
+MappedPointTable<Curve> get_cached_point_table(std::string const& dir, std::string const& cache_dir, size_t num_points)
+{
+    static std::mutex mutex;
+    static std::map<std::pair<std::string, std::string>,
+                    std::pair<size_t, std::weak_ptr<typename Curve::AffineElement[]>>>
+        mapped_tables;
+
+    const std::string cache_path = FileCrsFactory<Curve>::point_table_cache_path(cache_dir);
+    const auto key = std::make_pair(dir, cache_path);
+    std::lock_guard lock(mutex);
+    if (auto it = mapped_tables.find(key); it != mapped_tables.end() && it->second.first >= num_points) {
+        if (auto table = it->second.second.lock()) {
+            return { it->second.first, std::move(table) };
+        }
+    }
+
+    auto mapped = map_point_table_cache<Curve>(cache_path, dir, num_points);
+    if (!mapped.table) {
+        PROFILE_THIS_NAME("generate point table cache");
+        auto table = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+        srs::IO<Curve>::read_transcript_g1(table.get(), num_points, dir);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(table.get(), table.get(), num_points);
+        std::error_code error;
+        std::filesystem::create_directories(cache_dir, error);
+        if (write_point_table_cache<Curve>(cache_path, table.get(), num_points)) {
+            mapped = map_point_table_cache<Curve>(cache_path, dir, num_points);
+        } else {
+            vinfo("Could not write ", Curve::name, " point table cache to ", cache_path);
+        }
+        if (!mapped.table) {
+            // We still share the heap allocated table within the process.
+            mapped = { num_points, std::move(table) };
+        }
+    }
+    mapped_tables[key] = { mapped.num_points, mapped.table };
+    return mapped;
+}
+#endif
+
+} // namespace
 
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
     : precomputed_g2_lines((bb::pairing::miller_lines*)(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
@@ -48,8 +249,9 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, std::string point_table_cache_dir)
     : path_(std::move(path))
+    , point_table_cache_dir_(std::move(point_table_cache_dir))
     , prover_degree_(initial_degree)
     , verifier_degree_(initial_degree)
 {}
@@ -60,6 +262,16 @@ std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get
     PROFILE_THIS();
 
     if (prover_degree_ < degree || !prover_crs_) {
+#ifndef __wasm__
+        if (!point_table_cache_dir_.empty() && degree > 0) {
+            if (auto mapped = get_cached_point_table<Curve>(path_, point_table_cache_dir_, degree); mapped.table) {
+                prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, std::move(mapped.table));
+                prover_degree_ = degree;
+                vinfo("Initialized ", Curve::name, " prover CRS from point table cache of size ", degree);
+                return prover_crs_;
+            }
+        }
+#endif
         prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
         prover_degree_ = degree;
         vinfo("Initialized ", Curve::name, " prover CRS from file of size ", degree);
@@ -67,6 +279,11 @@ std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get
     return prover_crs_;
 }
 
+template <typename Curve> std::string FileCrsFactory<Curve>::point_table_cache_path(std::string const& cache_dir)
+{
+    return format(cache_dir, "/point_table_", Curve::name, ".dat");
+}
+
 template <typename Curve>
 std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::get_verifier_crs(size_t degree)
 {
@@ -12,18 +12,30 @@ namespace bb::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * @details If a point table cache directory is given, the prover CRS is served from a point table cache file in it (see
+ * point_table_cache_path). The cache holds the already expanded pippenger point table in Montgomery form and is mapped
+ * read-only, so processes share its pages through the page cache, provers in one process share one mapping, and only
+ * the prefix of the table that is actually used gets paged in. The cache is (re)generated from the transcript when it
+ * is missing, too small or a sample of its points does not match the transcript. Failing to write it is not an error:
+ * we then fall back to a heap allocated table. The cache is as large as the expanded table, i.e. several GB for a
+ * large SRS, so it is off by default.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, std::string point_table_cache_dir = "");
     FileCrsFactory(FileCrsFactory&& other) = default;
 
+    static std::string point_table_cache_path(std::string const& cache_dir);
+
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
 
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> get_verifier_crs(size_t degree = 0) override;
 
   private:
     std::string path_;
+    // Empty if the point table cache is disabled
+    std::string point_table_cache_dir_;
     size_t prover_degree_;
     size_t verifier_degree_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
@@ -53,6 +65,15 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
     };
 
+    /**
+     * @brief Construct a prover CRS on top of an already generated pippenger point table, e.g. one mapped from the
+     * point table cache. The table must be at least scalar_multiplication::point_table_size(num_points) long.
+     */
+    FileProverCrs(const size_t num_points, std::shared_ptr<typename Curve::AffineElement[]> point_table)
+        : num_points(num_points)
+        , monomials_(std::move(point_table))
+    {}
+
     ~FileProverCrs()
     {
 #ifdef TRACY_MEMORY
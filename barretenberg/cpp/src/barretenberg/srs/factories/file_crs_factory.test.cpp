@@ -0,0 +1,80 @@
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/srs/io.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace bb;
+using namespace bb::srs::factories;
+using namespace bb::curve;
+
+TEST(file_crs_factory, point_table_cache)
+{
+    // Write a small transcript to a scratch directory, and keep the cache in a directory of its own.
+    constexpr size_t num_points = 1000;
+    const auto dir = std::filesystem::temp_directory_path() / ("bb_point_table_cache_" + std::to_string(getpid()));
+    const auto cache_dir = dir / "cache";
+    const auto cache_path = FileCrsFactory<BN254>::point_table_cache_path(cache_dir.string());
+    std::filesystem::create_directories(dir / "monomial");
+    const auto write_transcript = [&]() {
+        std::vector<g1::affine_element> points(num_points);
+        for (auto& point : points) {
+            point = g1::affine_element::random_element();
+        }
+        ::srs::Manifest manifest{ 0, 1, num_points, 0, num_points, 0, 0 };
+        ::srs::IO<BN254>::write_transcript(points.data(), manifest, dir.string());
+    };
+    const auto expect_table_eq = [](const auto& expected, const auto& actual) {
+        EXPECT_EQ(memcmp(expected->get_monomial_points().data(),
+                         actual->get_monomial_points().data(),
+                         sizeof(g1::affine_element) * num_points * 2),
+                  0);
+    };
+    write_transcript();
+
+    // The cache is off by default.
+    FileCrsFactory<BN254> uncached_factory(dir.string());
+    auto expected = uncached_factory.get_prover_crs(num_points);
+    EXPECT_FALSE(std::filesystem::exists(cache_dir));
+
+    {
+        // The first factory creates the cache, the second one shares the mapping of the first.
+        FileCrsFactory<BN254> factory(dir.string(), 0, cache_dir.string());
+        auto prover_crs = factory.get_prover_crs(num_points);
+        EXPECT_TRUE(std::filesystem::exists(cache_path));
+        FileCrsFactory<BN254> other_factory(dir.string(), 0, cache_dir.string());
+        auto other_prover_crs = other_factory.get_prover_crs(num_points / 2);
+        EXPECT_EQ(other_prover_crs->get_monomial_points().data(), prover_crs->get_monomial_points().data());
+
+        EXPECT_EQ(prover_crs->get_monomial_size(), num_points);
+        expect_table_eq(expected, prover_crs);
+    }
+
+    // Once nobody holds on to the mapping, a new factory maps the cache file again.
+    auto reloaded_crs = FileCrsFactory<BN254>(dir.string(), 0, cache_dir.string()).get_prover_crs(num_points);
+    expect_table_eq(expected, reloaded_crs);
+    reloaded_crs.reset();
+
+    // Requesting more points than the cache holds fails just like reading the transcript does.
+    EXPECT_ANY_THROW(FileCrsFactory<BN254>(dir.string(), 0, cache_dir.string()).get_prover_crs(num_points + 1));
+
+    // A corrupted cache is regenerated. The last point is always among the sampled ones.
+    {
+        std::fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::out);
+        const g1::affine_element wrong_point = g1::affine_element::random_element();
+        // The table follows a 64 byte header
+        file.seekp(static_cast<std::streamoff>(64 + sizeof(g1::affine_element) * 2 * (num_points - 1)));
+        file.write(reinterpret_cast<const char*>(&wrong_point), sizeof(wrong_point));
+    }
+    expect_table_eq(expected, FileCrsFactory<BN254>(dir.string(), 0, cache_dir.string()).get_prover_crs(num_points));
+
+    // So is a cache of a different SRS.
+    write_transcript();
+    expected = FileCrsFactory<BN254>(dir.string()).get_prover_crs(num_points);
+    expect_table_eq(expected, FileCrsFactory<BN254>(dir.string(), 0, cache_dir.string()).get_prover_crs(num_points));
+
+    std::filesystem::remove_all(dir);
+}
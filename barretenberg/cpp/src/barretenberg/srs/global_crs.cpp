@@ -3,11 +3,14 @@
 #include "./factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include <mutex>
 
 namespace {
 // TODO(#637): As a PoC we have two global variables for the two CRS but this could be improved to avoid duplication.
 std::shared_ptr<bb::srs::factories::CrsFactory<bb::curve::BN254>> crs_factory;
 std::shared_ptr<bb::srs::factories::CrsFactory<bb::curve::Grumpkin>> grumpkin_crs_factory;
+// Guards the two factories above, which may be (re)initialized while other threads are proving (e.g. bb server).
+std::mutex crs_factory_mutex;
 } // namespace
 
 namespace bb::srs {
@@ -15,34 +18,50 @@ namespace bb::srs {
 // Initializes the crs using the memory buffers
 void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_element const g2_point)
 {
-    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
+    init_crs_factory(std::make_shared<factories::MemBn254CrsFactory>(points, g2_point));
+}
+
+void init_crs_factory(std::shared_ptr<factories::CrsFactory<curve::BN254>> factory)
+{
+    std::lock_guard lock(crs_factory_mutex);
+    crs_factory = std::move(factory);
 }
 
 // Initializes crs from a file path this we use in the entire codebase
 void init_crs_factory(std::string crs_path)
 {
+    std::lock_guard lock(crs_factory_mutex);
     if (crs_factory != nullptr) {
         return;
     }
-    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, get_point_table_cache_dir());
 }
 
 // Initializes the crs using the memory buffers
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points)
 {
-    grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(points);
+    init_grumpkin_crs_factory(std::make_shared<factories::MemGrumpkinCrsFactory>(points));
+}
+
+void init_grumpkin_crs_factory(std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> factory)
+{
+    std::lock_guard lock(crs_factory_mutex);
+    grumpkin_crs_factory = std::move(factory);
 }
 
 void init_grumpkin_crs_factory(std::string crs_path)
 {
+    std::lock_guard lock(crs_factory_mutex);
     if (grumpkin_crs_factory != nullptr) {
         return;
     }
-    grumpkin_crs_factory = std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path);
+    grumpkin_crs_factory =
+        std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path, 0, get_point_table_cache_dir());
 }
 
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory()
 {
+    std::lock_guard lock(crs_factory_mutex);
     if (!crs_factory) {
         throw_or_abort("You need to initialize the global CRS with a call to init_crs_factory(...)!");
     }
@@ -51,6 +70,7 @@ std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory()
 
 std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory()
 {
+    std::lock_guard lock(crs_factory_mutex);
     if (!grumpkin_crs_factory) {
         throw_or_abort("You need to initialize the global CRS with a call to init_grumpkin_crs_factory(...)!");
     }
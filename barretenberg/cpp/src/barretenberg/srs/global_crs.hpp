@@ -17,6 +17,13 @@ inline std::string get_grumpkin_crs_path()
     return env_var != nullptr ? std::string(env_var) : "../srs_db/grumpkin";
 }
 
+// Directory of the prover point table caches (see FileCrsFactory), which are only used if it is set
+inline std::string get_point_table_cache_dir()
+{
+    const char* env_var = std::getenv("BB_POINT_TABLE_CACHE_DIR");
+    return env_var != nullptr ? std::string(env_var) : "";
+}
+
 // Initializes the crs using files
 void init_crs_factory(std::string crs_path);
 void init_grumpkin_crs_factory(std::string crs_path);
@@ -25,6 +32,10 @@ void init_grumpkin_crs_factory(std::string crs_path);
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
 
+// Installs an existing factory, e.g. one that was kept around from an earlier initialization
+void init_crs_factory(std::shared_ptr<factories::CrsFactory<curve::BN254>> factory);
+void init_grumpkin_crs_factory(std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> factory);
+
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory();
 std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
 
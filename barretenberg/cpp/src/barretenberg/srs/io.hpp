@@ -328,6 +328,31 @@ template <typename Curve> class IO {
         }
     }
 
+    /**
+     * @brief Read the g1 point with the given index, without reading the points before it
+     */
+    static AffineElement read_transcript_g1_point(const size_t index, std::string const& dir)
+    {
+        size_t index_in_file = index;
+        size_t num = 0;
+        std::string path = get_transcript_path(dir, num);
+        while (is_file_exist(path)) {
+            Manifest manifest;
+            read_manifest(path, manifest);
+            if (index_in_file < manifest.num_g1_points) {
+                AffineElement point;
+                size_t size = 0;
+                read_file_into_buffer(
+                    (char*)&point, size, path, sizeof(Manifest) + index_in_file * sizeof(Fq) * 2, sizeof(Fq) * 2);
+                srs::IO<Curve>::byteswap(&point, size);
+                return point;
+            }
+            index_in_file -= manifest.num_g1_points;
+            path = get_transcript_path(dir, ++num);
+        }
+        throw_or_abort(format("Transcript g1 in ", dir, " has no point with index ", index, "."));
+    }
+
     static void read_transcript_g2(auto& g2_x, std::string const& dir)
         requires HasG2<Curve>
     {
@@ -11,6 +11,7 @@
 
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batch_affine_pippenger.hpp"
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -1066,3 +1067,132 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchAffine)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        scalars[static_cast<size_t>(i)] = Fr::random_element();
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        Element temp = points[i] * scalars[static_cast<size_t>(i)];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    Element result = scalar_multiplication::pippenger_batch_affine<Curve>(
+        { 0, scalars }, { points.get(), /*size*/ num_points * 2 });
+    result = result.normalize();
+
+    EXPECT_EQ(result == expected, true);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchAffineEdgeCaseDbl)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 4096;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+
+    // A single repeated point, half of the scalars equal (all additions collide in the same buckets) and a pair of
+    // points that cancel
+    AffineElement point = AffineElement(Element::random_element());
+    const Fr repeated_scalar = Fr::random_element();
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        scalars[static_cast<size_t>(i)] = (i & 1) ? repeated_scalar : Fr::random_element();
+        points[i] = point;
+    }
+    scalars[1] = -scalars[0];
+
+    Element expected;
+    expected.self_set_infinity();
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        Element temp = points[i] * scalars[static_cast<size_t>(i)];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    Element result = scalar_multiplication::pippenger_batch_affine<Curve>(
+        { 0, scalars }, { points.get(), /*size*/ num_points * 2 });
+    result = result.normalize();
+
+    EXPECT_EQ(result == expected, true);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchAffineShortInputs)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    constexpr size_t start_index = 123;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    // Zero, small and random scalars, starting at an offset into the point table
+    std::vector<Fr> scalars(num_points - start_index);
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        if (i % 3 == 0) {
+            scalars[i] = Fr::zero();
+        } else if (i % 3 == 1) {
+            scalars[i] = Fr(engine.get_random_uint32() & 0x07ULL);
+        } else {
+            scalars[i] = Fr::random_element();
+        }
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        Element temp = points[static_cast<std::ptrdiff_t>(start_index + i)] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    Element result = scalar_multiplication::pippenger_batch_affine<Curve>(
+        { start_index, scalars }, { points.get(), /*size*/ num_points * 2 });
+    result = result.normalize();
+
+    EXPECT_EQ(result == expected, true);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchAffineZeroPoints)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    std::vector<Fr> scalars;
+    std::vector<AffineElement> points;
+
+    Element result = scalar_multiplication::pippenger_batch_affine<Curve>({ 0, scalars }, points);
+
+    EXPECT_EQ(result.is_point_at_infinity(), true);
+}
@@ -82,6 +82,48 @@ TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMappi
         proving_key->polynomials.get_sigmas(), mapping.sigmas, proving_key.get());
 }
 
+TEST_F(PermutationHelperTests, HonkStylePolynomialsMatchMapping)
+{
+    // Copy cycles by real variable index, including a tagged cycle, a single node cycle and empty cycles
+    const uint32_t tag = circuit_constructor.create_tag(1, 2);
+    circuit_constructor.create_tag(2, 1);
+    const uint32_t tagged_variable = circuit_constructor.real_variable_index[4];
+    circuit_constructor.assign_tag(tagged_variable, tag);
+    std::vector<CyclicPermutation> copy_cycles(circuit_constructor.variables.size());
+    copy_cycles[circuit_constructor.real_variable_index[2]] = { { 0, 5 }, { 1, 6 }, { 2, 7 } };
+    copy_cycles[circuit_constructor.real_variable_index[3]] = { { 3, 3 } };
+    copy_cycles[tagged_variable] = { { 0, 4 }, { 1, 4 }, { 2, 2 }, { 3, 7 } };
+
+    proving_key->active_region_data.add_range(0, proving_key->circuit_size);
+    for (auto& sigma : proving_key->polynomials.get_sigmas()) {
+        sigma = typename Flavor::Polynomial(proving_key->circuit_size);
+    }
+    for (auto& id : proving_key->polynomials.get_ids()) {
+        id = typename Flavor::Polynomial(proving_key->circuit_size);
+    }
+    compute_honk_style_permutation_polynomials<Flavor>(circuit_constructor, proving_key.get(), copy_cycles);
+
+    auto mapping =
+        compute_permutation_mapping<Flavor, /*generalized=*/true>(circuit_constructor, proving_key.get(), copy_cycles);
+    std::array<typename Flavor::Polynomial, Flavor::NUM_WIRES> expected_sigmas;
+    std::array<typename Flavor::Polynomial, Flavor::NUM_WIRES> expected_ids;
+    for (size_t i = 0; i < Flavor::NUM_WIRES; ++i) {
+        expected_sigmas[i] = typename Flavor::Polynomial(proving_key->circuit_size);
+        expected_ids[i] = typename Flavor::Polynomial(proving_key->circuit_size);
+    }
+    compute_honk_style_permutation_lagrange_polynomials_from_mapping<Flavor>(
+        RefArray{ expected_sigmas[0], expected_sigmas[1], expected_sigmas[2], expected_sigmas[3] },
+        mapping.sigmas,
+        proving_key.get());
+    compute_honk_style_permutation_lagrange_polynomials_from_mapping<Flavor>(
+        RefArray{ expected_ids[0], expected_ids[1], expected_ids[2], expected_ids[3] }, mapping.ids, proving_key.get());
+
+    for (size_t i = 0; i < Flavor::NUM_WIRES; ++i) {
+        EXPECT_EQ(proving_key->polynomials.get_sigmas()[i], expected_sigmas[i]);
+        EXPECT_EQ(proving_key->polynomials.get_ids()[i], expected_ids[i]);
+    }
+}
+
 TEST_F(PermutationHelperTests, ComputeStandardAuxPolynomials)
 {
     // TODO(#425) Flesh out these tests
@@ -13,7 +13,10 @@
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_output.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_rho.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_theta.hpp"
+#include <algorithm>
+#include <atomic>
 #include <mutex>
+#include <unordered_map>
 namespace bb::plookup {
 
 using namespace bb;
@@ -23,7 +26,7 @@ namespace {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool initialised = false;
+std::atomic<bool> initialised = false;
 #ifndef NO_MULTITHREADING
 
 // The multitables initialisation procedure is not thread-safe, so we need to make sure only 1 thread gets to initialize
@@ -437,4 +440,120 @@ BasicTable create_basic_table(const BasicTableId id, const size_t index)
     }
     }
 }
+
+namespace {
+// A basic table in the process wide registry. Tables are generated under the lock of their own slot, so that threads
+// that need different tables do not wait for each other.
+struct BasicTableSlot {
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+    std::shared_ptr<const BasicTable> table;
+};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unordered_map<BasicTableId, std::unique_ptr<BasicTableSlot>> BASIC_TABLES;
+#ifndef NO_MULTITHREADING
+std::mutex basic_tables_mutex;
+#endif
+} // namespace
+
+std::shared_ptr<const BasicTable> get_basic_table(const BasicTableId id)
+{
+    BasicTableSlot* slot = nullptr;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(basic_tables_mutex);
+#endif
+        auto& entry = BASIC_TABLES[id];
+        if (!entry) {
+            entry = std::make_unique<BasicTableSlot>();
+        }
+        slot = entry.get();
+    }
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> slot_lock(slot->mutex);
+#endif
+    if (!slot->table) {
+        auto table = std::make_shared<BasicTable>(create_basic_table(id, 0));
+        // The index map is only needed by the prover (for the read counts), but building it once here is cheaper than
+        // building it for every proving key.
+        table->initialize_index_map();
+        slot->table = std::move(table);
+    }
+    return slot->table;
+}
+
+namespace {
+// The (id, table index) pairs of the tables of a circuit, in the order of the circuit's tables
+using TableSetKey = std::vector<std::pair<BasicTableId, size_t>>;
+
+// Table columns of the most recently used table sets, most recent first. Circuits of the same kind use the same tables,
+// so a process only sees a handful of sets; the bound keeps a long running process from accumulating columns of
+// circuits it no longer proves.
+constexpr size_t MAX_CACHED_TABLE_SETS = 8;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::vector<std::pair<TableSetKey, std::shared_ptr<const TableColumns>>> TABLE_COLUMNS;
+#ifndef NO_MULTITHREADING
+std::mutex table_columns_mutex;
+#endif
+
+// Look up the columns of a table set and mark them as most recently used. The caller holds table_columns_mutex.
+std::shared_ptr<const TableColumns> find_table_columns(const TableSetKey& key)
+{
+    for (auto it = TABLE_COLUMNS.begin(); it != TABLE_COLUMNS.end(); ++it) {
+        if (it->first == key) {
+            std::rotate(TABLE_COLUMNS.begin(), it, it + 1);
+            return TABLE_COLUMNS.front().second;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+std::shared_ptr<const TableColumns> get_table_columns(const std::vector<CircuitBasicTable>& tables)
+{
+    TableSetKey key;
+    key.reserve(tables.size());
+    size_t num_rows = 0;
+    for (const auto& table : tables) {
+        key.emplace_back(table.id(), table.table_index);
+        num_rows += table.size();
+    }
+
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(table_columns_mutex);
+#endif
+        if (auto cached = find_table_columns(key)) {
+            return cached;
+        }
+    }
+
+    // Build the columns without holding the lock. Should two threads build the same set, both results are identical
+    // and only one is kept.
+    auto columns = std::make_shared<TableColumns>();
+    for (auto& column : *columns) {
+        column.reserve(num_rows);
+    }
+    for (const auto& table : tables) {
+        const auto& basic_table = *table.table;
+        const bb::fr table_index(table.table_index);
+        (*columns)[0].insert((*columns)[0].end(), basic_table.column_1.begin(), basic_table.column_1.end());
+        (*columns)[1].insert((*columns)[1].end(), basic_table.column_2.begin(), basic_table.column_2.end());
+        (*columns)[2].insert((*columns)[2].end(), basic_table.column_3.begin(), basic_table.column_3.end());
+        (*columns)[3].insert((*columns)[3].end(), table.size(), table_index);
+    }
+
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(table_columns_mutex);
+#endif
+    if (auto cached = find_table_columns(key)) {
+        return cached;
+    }
+    if (TABLE_COLUMNS.size() == MAX_CACHED_TABLE_SETS) {
+        TABLE_COLUMNS.pop_back();
+    }
+    TABLE_COLUMNS.emplace(TABLE_COLUMNS.begin(), std::move(key), columns);
+    return columns;
+}
 } // namespace bb::plookup
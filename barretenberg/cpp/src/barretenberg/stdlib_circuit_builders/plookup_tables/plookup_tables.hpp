@@ -12,4 +12,18 @@ ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          bool is_2_to_1_lookup = false);
 
 BasicTable create_basic_table(BasicTableId id, size_t index);
+
+/**
+ * @brief Return the basic table with the provided ID, generating it (and its index map) if not generated already
+ * @details Basic tables are immutable once generated, so each of them is generated once per process and shared by all
+ * circuits that use it. Thread-safe.
+ */
+std::shared_ptr<const BasicTable> get_basic_table(BasicTableId id);
+
+/**
+ * @brief Return the table columns of a circuit with the provided lookup tables, building them if they are not cached
+ * @details Every proving key of a circuit with the same ordered set of tables has the same table polynomials, so their
+ * values are built once and copied into each key. The most recently used sets are kept. Thread-safe.
+ */
+std::shared_ptr<const TableColumns> get_table_columns(const std::vector<CircuitBasicTable>& tables);
 } // namespace bb::plookup
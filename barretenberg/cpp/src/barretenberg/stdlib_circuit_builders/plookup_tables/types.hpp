@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -331,7 +332,7 @@ struct LookupHashTable {
 
 /**
  * @brief A basic table from which we can perform lookups (for example, an xor table)
- * @details Also stores the lookup gate data for all lookups performed on this table
+ * @details The lookups that a circuit performs on the table are stored separately, see CircuitBasicTable
  *
  * @details You can find initialization example at
  * ../ultra_plonk_composer.cpp#UltraPlonkComposer::initialize_precomputed_table(..)
@@ -363,6 +364,7 @@ struct BasicTable {
 
     // Unique id of the table which is used to look it up, when we need its functionality. One of BasicTableId enum
     BasicTableId id;
+    // Index passed to the generator. Circuits number their tables themselves, see CircuitBasicTable::table_index
     size_t table_index;
     // This means that we are using two inputs to look up stuff, not translate a single entry into another one.
     bool use_twin_keys;
@@ -373,7 +375,6 @@ struct BasicTable {
     std::vector<bb::fr> column_1;
     std::vector<bb::fr> column_2;
     std::vector<bb::fr> column_3;
-    std::vector<LookupEntry> lookup_gates; // wire data for all lookup gates created for lookups on this table
 
     // Map from a table entry to its index in the table; used for constructing read counts
     LookupHashTable index_map;
@@ -391,6 +392,35 @@ struct BasicTable {
     }
 };
 
+/**
+ * @brief A basic table as used by one circuit
+ * @details The contents of a basic table do not depend on the circuit using it, so they are generated once per process
+ * and shared by all circuits (see get_basic_table). Only the position of the table among the tables of the circuit and
+ * the lookups performed on it belong to the circuit, and copying a circuit copies only these.
+ */
+struct CircuitBasicTable {
+    std::shared_ptr<const BasicTable> table;
+    // Index of the table among the tables used by the circuit, i.e. the q_3 selector value of its lookup gates
+    size_t table_index;
+    // Wire data for all lookup gates created for lookups on this table
+    std::vector<BasicTable::LookupEntry> lookup_gates;
+
+    BasicTableId id() const { return table->id; }
+    size_t size() const { return table->size(); }
+
+    bool operator==(const CircuitBasicTable& other) const
+    {
+        return id() == other.id() && table_index == other.table_index && lookup_gates == other.lookup_gates;
+    }
+};
+
+/**
+ * @brief The values of the four table polynomials over the rows taken by a circuit's lookup tables
+ * @details The first three are the concatenated columns of the tables, the fourth is the table index of each row. They
+ * only depend on which tables the circuit uses and in which order, see get_table_columns.
+ */
+using TableColumns = std::array<std::vector<bb::fr>, 4>;
+
 enum ColumnIdx { C1, C2, C3 };
 
 /**
@@ -730,23 +730,26 @@ uint32_t UltraCircuitBuilder_<ExecutionTrace>::put_constant_variable(const FF& v
 }
 
 /**
- * @brief Get the basic table with provided ID from the set of tables for the present circuit; create it if it doesnt
+ * @brief Get the basic table with provided ID from the set of tables for the present circuit; add it if it doesnt
  * yet exist
+ * @details The table contents come from the process wide registry, so adding a table to a circuit only generates it if
+ * no circuit has used it before.
  *
  * @tparam ExecutionTrace
  * @param id
- * @return plookup::BasicTable&
+ * @return plookup::CircuitBasicTable&
  */
 template <typename ExecutionTrace>
-plookup::BasicTable& UltraCircuitBuilder_<ExecutionTrace>::get_table(const plookup::BasicTableId id)
+plookup::CircuitBasicTable& UltraCircuitBuilder_<ExecutionTrace>::get_table(const plookup::BasicTableId id)
 {
-    for (plookup::BasicTable& table : lookup_tables) {
-        if (table.id == id) {
+    for (plookup::CircuitBasicTable& table : lookup_tables) {
+        if (table.id() == id) {
             return table;
         }
     }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
+    // Table doesn't exist in this circuit yet! So add it.
+    lookup_tables.push_back(
+        { .table = plookup::get_basic_table(id), .table_index = lookup_tables.size(), .lookup_gates = {} });
     return lookup_tables.back();
 }
 
@@ -2971,8 +2974,9 @@ template <typename ExecutionTrace> msgpack::sbuffer UltraCircuitBuilder_<Executi
         const FF table_index(table.table_index);
         info("Table no: ", table.table_index);
         std::vector<std::vector<FF>> tmp_table;
+        const auto& basic_table = *table.table;
         for (size_t i = 0; i < table.size(); ++i) {
-            tmp_table.push_back({ table.column_1[i], table.column_2[i], table.column_3[i] });
+            tmp_table.push_back({ basic_table.column_1[i], basic_table.column_2[i], basic_table.column_3[i] });
         }
         cir.lookup_tables.push_back(tmp_table);
     }
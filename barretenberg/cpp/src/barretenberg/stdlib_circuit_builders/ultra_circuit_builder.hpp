@@ -296,8 +296,9 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
     std::map<FF, uint32_t> constant_variable_indices;
 
-    // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table
-    std::vector<plookup::BasicTable> lookup_tables;
+    // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table. The table
+    // contents are shared with all other circuits using the same tables.
+    std::vector<plookup::CircuitBasicTable> lookup_tables;
 
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
@@ -750,7 +751,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
                                       bool (*generator)(std::vector<FF>&, std::vector<FF>&, std::vector<FF>&),
                                       std::array<FF, 2> (*get_values_from_key)(const std::array<uint64_t, 2>));
 
-    plookup::BasicTable& get_table(const plookup::BasicTableId id);
+    plookup::CircuitBasicTable& get_table(const plookup::BasicTableId id);
     plookup::MultiTable& get_multitable(const plookup::MultiTableId id);
 
     plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
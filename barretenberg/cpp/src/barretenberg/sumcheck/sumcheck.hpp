@@ -166,6 +166,21 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+
+    /**
+     * @brief Non-ZK only: whether the partial evaluation at the challenge of each round is fused with the computation
+     * of the next round univariate (see SumcheckProverRound::compute_univariate_with_partial_evaluation).
+     * @details The folded table cannot be written in place by several threads at once, so the fused mode alternates
+     * between two book-keeping tables, the second one being half the size of the first.
+     */
+    bool use_fused_partial_evaluation = true;
+    /**
+     * @brief In the fused mode, whether the round 1 univariate is computed from the prover polynomials folded on the
+     * fly, so that the first book-keeping table has n/4 rows instead of n/2. The two tables then take 3n/8 rows in
+     * total, instead of the n/2 rows of the unfused mode.
+     */
+    bool skip_round_1_table = true;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
         : multivariate_n(multivariate_n)
@@ -195,6 +210,10 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has ZK,
         // compute_univariate also takes into account the zk_sumcheck_data.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alpha);
+        if (use_fused_partial_evaluation) {
+            return prove_with_fused_partial_evaluation(
+                full_polynomials, relation_parameters, alpha, gate_separators, round_univariate);
+        }
         // Initialize the partially evaluated polynomials which will be used in the following rounds.
         // This will use the information in the structured full polynomials to save memory if possible.
         partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
@@ -249,6 +268,118 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         vinfo("finished sumcheck");
     };
 
+    /**
+     * @brief The rounds 1, ..., d-1 of the non-ZK `prove` with fused partial evaluation.
+     * @details After the challenge \f$ u_i \f$ is computed, a single pass over the current book-keeping table folds
+     * it at \f$ u_i \f$ into the next table and accumulates the round \f$ i+1 \f$ univariate from the folded rows.
+     * If #skip_round_1_table is set, the first pass does not store the table folded at \f$ u_0 \f$; the second pass
+     * then folds the prover polynomials at both \f$ u_0 \f$ and \f$ u_1 \f$.
+     *
+     * @param round_univariate The round 0 univariate
+     */
+    SumcheckOutput<Flavor> prove_with_fused_partial_evaluation(ProverPolynomials& full_polynomials,
+                                                               const bb::RelationParameters<FF>& relation_parameters,
+                                                               const RelationSeparator alpha,
+                                                               bb::GateSeparatorPolynomial<FF>& gate_separators,
+                                                               SumcheckRoundUnivariate round_univariate)
+    {
+        // The challenges that have not yet been folded into the current book-keeping table (or into the prover
+        // polynomials, as long as no table has been materialized)
+        std::vector<FF> pending_challenges;
+        bool table_materialized = false;
+        // The second table of the ping-pong pair; partially_evaluated_polynomials always holds the current table
+        PartiallyEvaluatedMultivariates next_table;
+
+        vinfo("starting sumcheck rounds...");
+        for (size_t round_idx = 0; round_idx < multivariate_d; round_idx++) {
+            PROFILE_THIS_NAME("sumcheck loop");
+
+            if (round_idx > 0) {
+                if (!table_materialized && skip_round_1_table && round_idx == 1) {
+                    round_univariate = round.compute_univariate_with_partial_evaluation(
+                        full_polynomials, nullptr, pending_challenges, relation_parameters, gate_separators, alpha);
+                } else if (!table_materialized) {
+                    const size_t num_folds = pending_challenges.size();
+                    allocate_folded_table(partially_evaluated_polynomials, full_polynomials, num_folds);
+                    allocate_folded_table(next_table, full_polynomials, num_folds + 1);
+                    auto* table = &partially_evaluated_polynomials;
+                    round_univariate = round.compute_univariate_with_partial_evaluation(
+                        full_polynomials, table, pending_challenges, relation_parameters, gate_separators, alpha);
+                    table_materialized = true;
+                    pending_challenges.clear();
+                } else {
+                    // Reuse the memory of the table before last, which is large enough for the next one
+                    for (auto [next_poly, poly] :
+                         zip_view(next_table.get_all(), partially_evaluated_polynomials.get_all())) {
+                        next_poly.shrink_end_index(poly.end_index() / 2 + poly.end_index() % 2);
+                    }
+                    round_univariate = round.compute_univariate_with_partial_evaluation(partially_evaluated_polynomials,
+                                                                                        &next_table,
+                                                                                        pending_challenges,
+                                                                                        relation_parameters,
+                                                                                        gate_separators,
+                                                                                        alpha);
+                    std::swap(partially_evaluated_polynomials, next_table);
+                    pending_challenges.clear();
+                }
+            }
+            // Place evaluations of Sumcheck Round Univariate in the transcript
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            multivariate_challenge.emplace_back(round_challenge);
+            pending_challenges.emplace_back(round_challenge);
+            gate_separators.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
+
+        // Fold the last challenge(s) to obtain the evaluations in the top row of the table. This only involves at most
+        // 4 rows per polynomial, so there is no point in fusing it
+        if (table_materialized) {
+            partially_evaluate(partially_evaluated_polynomials, pending_challenges[0]);
+        } else {
+            partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
+            partially_evaluate(full_polynomials, pending_challenges[0]);
+            for (size_t idx = 1; idx < pending_challenges.size(); idx++) {
+                partially_evaluate(partially_evaluated_polynomials, pending_challenges[idx]);
+            }
+        }
+        vinfo("completed ", multivariate_d, " rounds of sumcheck");
+
+        // Zero univariates are used to pad the proof to the fixed size virtual_log_n.
+        auto zero_univariate = bb::Univariate<FF, Flavor::BATCHED_RELATION_PARTIAL_LENGTH>::zero();
+        for (size_t idx = multivariate_d; idx < virtual_log_n; idx++) {
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(idx), zero_univariate);
+            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(idx));
+            multivariate_challenge.emplace_back(round_challenge);
+        }
+        // Claimed evaluations of Prover polynomials are extracted and added to the transcript.
+        ClaimedEvaluations multivariate_evaluations = extract_claimed_evaluations(partially_evaluated_polynomials);
+        transcript->send_to_verifier("Sumcheck:evaluations", multivariate_evaluations.get_all());
+
+        return SumcheckOutput<Flavor>{ .challenge = multivariate_challenge,
+                                       .claimed_evaluations = multivariate_evaluations };
+    }
+
+    /**
+     * @brief Allocate a book-keeping table for the prover polynomials partially evaluated at `num_folds` challenges.
+     * @details Every row below the end index of a table polynomial gets written by the fold, so the memory is not
+     * zeroed.
+     */
+    void allocate_folded_table(PartiallyEvaluatedMultivariates& table,
+                               const ProverPolynomials& full_polynomials,
+                               const size_t num_folds)
+    {
+        PROFILE_THIS_NAME("allocate_folded_table");
+        using Polynomial = typename Flavor::Polynomial;
+
+        const size_t fold_width = 1UL << num_folds;
+        for (auto [poly, full_poly] : zip_view(table.get_all(), full_polynomials.get_all())) {
+            poly = Polynomial((full_poly.end_index() + fold_width - 1) >> num_folds,
+                              multivariate_n >> num_folds,
+                              Polynomial::DontZeroMemory::FLAG);
+        }
+    }
+
     /**
      * @brief ZK-version of `prove` that runs Sumcheck with disabled rows and masking of Round Univariates.
      * The masking is ensured by adding random Libra univariates to the Sumcheck round univariates.
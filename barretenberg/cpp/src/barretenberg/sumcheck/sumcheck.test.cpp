@@ -167,6 +167,58 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    /**
+     * @brief Check that fusing the partial evaluation with the next round (with and without the round 1 table) gives
+     * the same proof and claimed evaluations as the unfused prover, including for polynomials shorter than the circuit
+     * size.
+     */
+    void test_fused_partial_evaluation(const size_t multivariate_d)
+    {
+        const size_t multivariate_n(1 << multivariate_d);
+
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (size_t idx = 0; idx < random_polynomials.size(); idx++) {
+            // Vary the end index of the polynomials, including empty and odd-sized ones
+            const size_t size = (idx * 7) % (multivariate_n + 1);
+            random_polynomials[idx] = Polynomial<FF>(size, multivariate_n);
+            for (auto& coeff : random_polynomials[idx].coeffs()) {
+                coeff = FF::random_element();
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+        auto relation_parameters = RelationParameters<FF>::get_random();
+
+        auto prove = [&](bool use_fused_partial_evaluation, bool skip_round_1_table) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            sumcheck.use_fused_partial_evaluation = use_fused_partial_evaluation;
+            sumcheck.skip_round_1_table = skip_round_1_table;
+
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            auto output = sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+            return std::make_pair(output, transcript->proof_data);
+        };
+
+        auto [expected_output, expected_proof] = prove(false, false);
+        for (bool skip_round_1_table : { false, true }) {
+            auto [output, proof] = prove(true, skip_round_1_table);
+            EXPECT_EQ(output.challenge, expected_output.challenge);
+            for (auto [eval, expected_eval] :
+                 zip_view(output.claimed_evaluations.get_all(), expected_output.claimed_evaluations.get_all())) {
+                EXPECT_EQ(eval, expected_eval);
+            }
+            EXPECT_EQ(proof, expected_proof);
+        }
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -387,6 +439,16 @@ TYPED_TEST(SumcheckTests, PolynomialNormalization)
         GTEST_SKIP() << "Skipping test for ZK-enabled flavors";
     }
 }
+TYPED_TEST(SumcheckTests, FusedPartialEvaluation)
+{
+    if constexpr (!TypeParam::HasZK) {
+        for (size_t multivariate_d : { 1, 2, 3, 6 }) {
+            this->test_fused_partial_evaluation(multivariate_d);
+        }
+    } else {
+        GTEST_SKIP() << "The fused partial evaluation is only used by the non-ZK prover";
+    }
+}
 // Test the prover
 TYPED_TEST(SumcheckTests, Prover)
 {
@@ -48,6 +48,7 @@ template <typename Flavor> class SumcheckProverRound {
     using ExtendedEdges = std::conditional_t<Flavor::USE_SHORT_MONOMIALS,
                                              typename Flavor::template ProverUnivariates<2>,
                                              typename Flavor::ExtendedEdges>;
+    using PartiallyEvaluatedMultivariates = typename Flavor::PartiallyEvaluatedMultivariates;
     using ZKData = ZKSumcheckData<Flavor>;
     /**
      * @brief In Round \f$i = 0,\ldots, d-1\f$, equals \f$2^{d-i}\f$.
@@ -75,6 +76,20 @@ template <typename Flavor> class SumcheckProverRound {
     // The length of the polynomials used to mask the Sumcheck Round Univariates.
     static constexpr size_t LIBRA_UNIVARIATES_LENGTH = Flavor::Curve::LIBRA_UNIVARIATES_LENGTH;
 
+    /**
+     * @brief Number of edges extended at once in the blocked mode of compute_univariate.
+     * @details Chosen so that a tile of ExtendedEdges (roughly) fits in a 512KB share of L2, with at least 2 edges per
+     * tile so that every polynomial is read at least a full cache line at a time.
+     */
+    static constexpr size_t BLOCKED_TILE_NUM_EDGES =
+        std::max<size_t>(2, std::min<size_t>(32, (1UL << 19) / sizeof(ExtendedEdges)));
+
+    /**
+     * @brief Whether compute_univariate extends edges a tile at a time, polynomial by polynomial (see
+     * extend_edges_tile), rather than one edge at a time across all polynomials. Both modes give identical results.
+     */
+    bool use_blocked_evaluation = true;
+
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -134,6 +149,186 @@ template <typename Flavor> class SumcheckProverRound {
         }
     }
 
+    /**
+     * @brief A tile of ExtendedEdges for the blocked mode of compute_univariate, along with the views into each of its
+     * elements (so that get_all() is evaluated once per tile element rather than once per polynomial).
+     */
+    struct ExtendedEdgesTile {
+        std::vector<ExtendedEdges> edges;
+        std::vector<decltype(std::declval<ExtendedEdges&>().get_all())> views;
+
+        explicit ExtendedEdgesTile(size_t num_edges)
+            : edges(num_edges)
+        {
+            views.reserve(num_edges);
+            for (auto& extended_edges : edges) {
+                views.emplace_back(extended_edges.get_all());
+            }
+        }
+    };
+
+    /**
+     * @brief Blocked version of \ref extend_edges "extend edges" for the edges in [start_edge_idx, end_edge_idx).
+     * @details extend_edges touches one cache line of each of the (often hundreds of) polynomials per edge, i.e. it
+     * walks all of the polynomial arrays in lock-step, which defeats the hardware prefetchers and evicts the relation
+     * inputs from cache. Here the outer loop is over the polynomials instead: each one is read as a contiguous run of
+     * 2 * tile size rows and extended into the tile, which is small enough to stay in L2 until the relations consume
+     * it.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void extend_edges_tile(ExtendedEdgesTile& tile,
+                           const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                           const size_t start_edge_idx,
+                           const size_t end_edge_idx)
+    {
+        size_t poly_idx = 0;
+        for (auto& multivariate : multivariates.get_all()) {
+            for (size_t edge_idx = start_edge_idx, tile_idx = 0; edge_idx < end_edge_idx; edge_idx += 2, ++tile_idx) {
+                auto& extended_edge = tile.views[tile_idx][poly_idx];
+                bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
+                if constexpr (Flavor::USE_SHORT_MONOMIALS) {
+                    extended_edge = edge;
+                } else {
+                    if (multivariate.end_index() < edge_idx) {
+                        static const auto zero_univariate = bb::Univariate<FF, MAX_PARTIAL_RELATION_LENGTH>::zero();
+                        extended_edge = zero_univariate;
+                    } else {
+                        extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+                    }
+                }
+            }
+            ++poly_idx;
+        }
+    }
+
+    /**
+     * @brief Fold rows of \p source with \p challenges and extend the folded edges in [start_edge_idx, end_edge_idx)
+     * into the tile.
+     * @details Row \f$ \ell \f$ of the folded table is obtained from rows \f$ 2^k \ell, \ldots, 2^k (\ell + 1) - 1 \f$
+     * of \p source by partially evaluating at the \f$ k \f$ challenges one after the other, exactly as repeated calls
+     * to SumcheckProver::partially_evaluate would. If \p target is not null, the folded rows are also written to it.
+     * Rows at or beyond CEIL(source.end_index() / 2^k) are zero and are neither computed nor written.
+     */
+    template <typename SourcePolynomials>
+    void fold_and_extend_edges_tile(ExtendedEdgesTile& tile,
+                                    const SourcePolynomials& source,
+                                    PartiallyEvaluatedMultivariates* target,
+                                    std::span<const FF> challenges,
+                                    const size_t start_edge_idx,
+                                    const size_t end_edge_idx)
+    {
+        ASSERT(challenges.size() == 1 || challenges.size() == 2);
+        const size_t num_folds = challenges.size();
+        const auto fold_row = [&](const auto& poly, const size_t row_idx) {
+            const size_t source_idx = row_idx << num_folds;
+            const FF low = poly[source_idx] + challenges[0] * (poly[source_idx + 1] - poly[source_idx]);
+            if (num_folds == 1) {
+                return low;
+            }
+            const FF high = poly[source_idx + 2] + challenges[0] * (poly[source_idx + 3] - poly[source_idx + 2]);
+            return low + challenges[1] * (high - low);
+        };
+
+        std::optional<decltype(target->get_all())> target_polys;
+        if (target != nullptr) {
+            target_polys.emplace(target->get_all());
+        }
+
+        size_t poly_idx = 0;
+        for (auto& poly : source.get_all()) {
+            const size_t folded_end_index = (poly.end_index() + (1UL << num_folds) - 1) >> num_folds;
+            for (size_t edge_idx = start_edge_idx, tile_idx = 0; edge_idx < end_edge_idx; edge_idx += 2, ++tile_idx) {
+                auto& extended_edge = tile.views[tile_idx][poly_idx];
+                if (edge_idx >= folded_end_index) {
+                    static const auto zero_univariate = std::remove_reference_t<decltype(extended_edge)>::zero();
+                    extended_edge = zero_univariate;
+                    continue;
+                }
+                bb::Univariate<FF, 2> edge({ fold_row(poly, edge_idx), FF::zero() });
+                if (edge_idx + 1 < folded_end_index) {
+                    edge.value_at(1) = fold_row(poly, edge_idx + 1);
+                }
+                if (target_polys) {
+                    auto& target_poly = (*target_polys)[poly_idx];
+                    target_poly.at(edge_idx) = edge.value_at(0);
+                    if (edge_idx + 1 < folded_end_index) {
+                        target_poly.at(edge_idx + 1) = edge.value_at(1);
+                    }
+                }
+                if constexpr (Flavor::USE_SHORT_MONOMIALS) {
+                    extended_edge = edge;
+                } else {
+                    extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+                }
+            }
+            ++poly_idx;
+        }
+    }
+
+    /**
+     * @brief Accumulate the relation contributions of the edges in [start_edge_idx, end_edge_idx), using either the
+     * blocked or the per-edge extension depending on use_blocked_evaluation.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void accumulate_edge_range(SumcheckTupleOfTuplesOfUnivariates& accumulators,
+                               ExtendedEdgesTile& tile,
+                               const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                               const size_t start_edge_idx,
+                               const size_t end_edge_idx,
+                               const bb::RelationParameters<FF>& relation_parameters,
+                               const bb::GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        // Compute the \f$ \ell \f$-th edge's univariate contribution, scale it by the corresponding \f$ pow_{\beta}
+        // \f$ contribution and add it to the accumulators for \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary
+        // representation is given by \f$ (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+        // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+        if (!use_blocked_evaluation) {
+            for (size_t edge_idx = start_edge_idx; edge_idx < end_edge_idx; edge_idx += 2) {
+                extend_edges(tile.edges[0], polynomials, edge_idx);
+                accumulate_relation_univariates(accumulators,
+                                                tile.edges[0],
+                                                relation_parameters,
+                                                gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+            }
+            return;
+        }
+        accumulate_tiles(accumulators,
+                         tile,
+                         start_edge_idx,
+                         end_edge_idx,
+                         relation_parameters,
+                         gate_separators,
+                         [&](size_t tile_start, size_t tile_end) {
+                             extend_edges_tile(tile, polynomials, tile_start, tile_end);
+                         });
+    }
+
+    /**
+     * @brief Accumulate the relation contributions of the edges in [start_edge_idx, end_edge_idx) one tile at a time,
+     * where `extend_tile(tile_start, tile_end)` fills the tile with the extended edges of [tile_start, tile_end).
+     */
+    template <typename ExtendTile>
+    void accumulate_tiles(SumcheckTupleOfTuplesOfUnivariates& accumulators,
+                          ExtendedEdgesTile& tile,
+                          const size_t start_edge_idx,
+                          const size_t end_edge_idx,
+                          const bb::RelationParameters<FF>& relation_parameters,
+                          const bb::GateSeparatorPolynomial<FF>& gate_separators,
+                          const ExtendTile& extend_tile)
+    {
+        const size_t tile_num_rows = 2 * tile.edges.size();
+        for (size_t tile_start = start_edge_idx; tile_start < end_edge_idx; tile_start += tile_num_rows) {
+            const size_t tile_end = std::min(tile_start + tile_num_rows, end_edge_idx);
+            extend_tile(tile_start, tile_end);
+            for (size_t edge_idx = tile_start, tile_idx = 0; edge_idx < tile_end; edge_idx += 2, ++tile_idx) {
+                accumulate_relation_univariates(accumulators,
+                                                tile.edges[tile_idx],
+                                                relation_parameters,
+                                                gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+            }
+        }
+    }
+
     /**
      * @brief Non-ZK version: Return the evaluations of the univariate round polynomials \f$ \tilde{S}_{i} (X_{i}) \f$
      at \f$ X_{i } = 0,\ldots, D \f$. Most likely, \f$ D \f$ is around  \f$ 12 \f$. At the
@@ -164,6 +359,71 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        accumulate_edges_in_parallel(
+            use_blocked_evaluation ? BLOCKED_TILE_NUM_EDGES : 1,
+            [&](SumcheckTupleOfTuplesOfUnivariates& accumulators, ExtendedEdgesTile& tile, size_t start, size_t end) {
+                accumulate_edge_range(
+                    accumulators, tile, polynomials, start, end, relation_parameters, gate_separators);
+            });
+
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+    }
+
+    /**
+     * @brief Non-ZK version of compute_univariate for a round whose book-keeping table has not been computed yet.
+     * @details The book-keeping table of the current round is \p source (the prover polynomials, or the table of an
+     * earlier round) partially evaluated at the outstanding \p challenges, see fold_and_extend_edges_tile. Instead of
+     * writing that table out with SumcheckProver::partially_evaluate and reading it back here, each tile of edges is
+     * folded, written to \p target and then extended and accumulated while it is still in cache. This roughly halves
+     * the memory traffic of a round. If \p target is null the folded table is not stored at all, so a later round has
+     * to fold \p source again.
+     *
+     * Threads write disjoint row ranges of \p target while reading \p source, so \p target must not alias \p source.
+     * Its polynomials must have end index CEIL(end index of the source polynomial / 2^k) for k challenges.
+     * The result does not depend on use_blocked_evaluation; the folded edges are always processed a tile at a time.
+     *
+     * @param source The table to be folded, with 2^k * #round_size rows
+     * @param target The book-keeping table of the current round (optional)
+     * @param challenges The k = 1 or 2 challenges that have not yet been folded into \p source
+     */
+    template <typename SourcePolynomials>
+    SumcheckRoundUnivariate compute_univariate_with_partial_evaluation(
+        const SourcePolynomials& source,
+        PartiallyEvaluatedMultivariates* target,
+        std::span<const FF> challenges,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_separators,
+        const RelationSeparator alpha)
+    {
+        PROFILE_THIS_NAME("compute_univariate_with_partial_evaluation");
+
+        accumulate_edges_in_parallel(
+            BLOCKED_TILE_NUM_EDGES,
+            [&](SumcheckTupleOfTuplesOfUnivariates& accumulators, ExtendedEdgesTile& tile, size_t start, size_t end) {
+                accumulate_tiles(accumulators,
+                                 tile,
+                                 start,
+                                 end,
+                                 relation_parameters,
+                                 gate_separators,
+                                 [&](size_t tile_start, size_t tile_end) {
+                                     fold_and_extend_edges_tile(tile, source, target, challenges, tile_start, tile_end);
+                                 });
+            });
+
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+    }
+
+    /**
+     * @brief Split the edges of the current round between threads and accumulate their contributions into
+     * #univariate_accumulators, where `accumulate_range(accumulators, tile, start, end)` accumulates the edges in
+     * [start, end) into a thread's accumulators using a thread-local tile of `tile_num_edges` edges.
+     */
+    template <typename AccumulateRange>
+    void accumulate_edges_in_parallel(const size_t tile_num_edges, const AccumulateRange& accumulate_range)
+    {
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
@@ -243,22 +503,11 @@ template <typename Flavor> class SumcheckProverRound {
             // Initialize the thread accumulator to 0
             Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
             // Construct extended univariates containers; one per thread
-            ExtendedEdges extended_edges;
+            ExtendedEdgesTile tile(tile_num_edges);
             for (size_t chunk_idx = 0; chunk_idx < num_of_chunks; chunk_idx++) {
                 size_t start = chunk_idx * chunk_size + thread_idx * chunk_thread_portion_size;
                 size_t end = chunk_idx * chunk_size + (thread_idx + 1) * chunk_thread_portion_size;
-                for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                    extend_edges(extended_edges, polynomials, edge_idx);
-                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
-                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
-                    // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
-                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
-                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                    extended_edges,
-                                                    relation_parameters,
-                                                    gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
-                }
+                accumulate_range(thread_univariate_accumulators[thread_idx], tile, start, end);
             }
         });
 
@@ -266,9 +515,6 @@ template <typename Flavor> class SumcheckProverRound {
         for (auto& accumulators : thread_univariate_accumulators) {
             Utils::add_nested_tuples(univariate_accumulators, accumulators);
         }
-
-        // Batch the univariate contributions from each sub-relation to obtain the round univariate
-        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
     }
 
     /**
@@ -303,21 +549,16 @@ template <typename Flavor> class SumcheckProverRound {
             // Initialize the thread accumulator to 0
             Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
             // Construct extended univariates containers; one per thread
-            ExtendedEdges extended_edges;
+            ExtendedEdgesTile tile(use_blocked_evaluation ? BLOCKED_TILE_NUM_EDGES : 1);
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges, polynomials, edge_idx);
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges,
-                                                relation_parameters,
-                                                gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
-            }
+            accumulate_edge_range(thread_univariate_accumulators[thread_idx],
+                                  tile,
+                                  polynomials,
+                                  start,
+                                  end,
+                                  relation_parameters,
+                                  gate_separators);
         });
 
         // Accumulate the per-thread univariate accumulators into a single set of accumulators
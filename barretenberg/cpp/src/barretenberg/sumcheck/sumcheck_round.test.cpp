@@ -131,3 +131,47 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check that the blocked (tiled) evaluation of the round univariate agrees with the per-edge evaluation
+ *
+ */
+TEST(SumcheckRound, BlockedComputeUnivariate)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+
+    // Use enough edges that the blocked evaluation spans several tiles
+    const size_t log_num_rows = 7;
+    const size_t num_rows = 1UL << log_num_rows;
+    static_assert(SumcheckProverRound<Flavor>::BLOCKED_TILE_NUM_EDGES < num_rows / 2);
+
+    typename Flavor::ProverPolynomials polynomials(num_rows);
+    for (auto& polynomial : polynomials.get_unshifted()) {
+        for (size_t i = polynomial.start_index(); i < polynomial.end_index(); ++i) {
+            polynomial.at(i) = FF::random_element();
+        }
+    }
+    polynomials.set_shifted();
+
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    std::vector<FF> betas(log_num_rows);
+    for (auto& beta : betas) {
+        beta = FF::random_element();
+    }
+    GateSeparatorPolynomial<FF> gate_separators(betas, log_num_rows);
+    typename Flavor::RelationSeparator alphas;
+    for (auto& alpha : alphas) {
+        alpha = FF::random_element();
+    }
+
+    SumcheckProverRound<Flavor> blocked_round(num_rows);
+    SumcheckProverRound<Flavor> per_edge_round(num_rows);
+    per_edge_round.use_blocked_evaluation = false;
+
+    auto blocked_univariate =
+        blocked_round.compute_univariate(polynomials, relation_parameters, gate_separators, alphas);
+    auto per_edge_univariate =
+        per_edge_round.compute_univariate(polynomials, relation_parameters, gate_separators, alphas);
+    EXPECT_EQ(blocked_univariate, per_edge_univariate);
+}
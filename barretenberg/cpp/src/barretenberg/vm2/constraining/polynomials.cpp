@@ -25,6 +25,18 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                            // We need at least 2 rows for the shifted columns.
                            uint32_t num_rows = std::max<uint32_t>(trace.get_column_rows(col), 2);
 
+                           // Dense columns are handed over as row-contiguous memory. Row 0 of a to-be-shifted column is
+                           // always zero, so the polynomial memory starts at row 1.
+                           if (auto rows = trace.release_column(col)) {
+                               poly = AvmProver::Polynomial(
+                                   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+                                   std::shared_ptr<AvmProver::FF[]>(rows, rows.get() + 1),
+                                   /*memory size*/ num_rows - 1,
+                                   /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
+                                   /*make shiftable with offset*/ 1);
+                               continue;
+                           }
+
                            poly = AvmProver::Polynomial(
                                /*memory size*/
                                num_rows - 1,
@@ -57,6 +69,10 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(i);
                            const auto num_rows = trace.get_column_rows(col);
+                           if (auto rows = trace.release_column(col)) {
+                               poly = AvmProver::Polynomial(std::move(rows), num_rows, CIRCUIT_SUBGROUP_SIZE);
+                               return;
+                           }
                            poly = AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
                        });
                    }));
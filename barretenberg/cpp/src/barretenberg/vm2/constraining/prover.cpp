@@ -51,8 +51,14 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     const auto& labels = prover_polynomials.get_wires_labels();
+    std::vector<PolynomialSpan<const FF>> wire_spans;
+    wire_spans.reserve(wire_polys.size());
+    for (auto& poly : wire_polys) {
+        wire_spans.emplace_back(poly);
+    }
+    auto commitments = commitment_key->commit_batch(wire_spans);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
@@ -78,8 +84,13 @@ void AvmProver::execute_log_derivative_inverse_round()
 void AvmProver::execute_log_derivative_inverse_commitments_round()
 {
     // Commit to all logderivative inverse polynomials
-    for (auto [commitment, key_poly] : zip_view(witness_commitments.get_derived(), key->get_derived())) {
-        commitment = commitment_key->commit(key_poly);
+    std::vector<PolynomialSpan<const FF>> derived_spans;
+    for (auto& key_poly : key->get_derived()) {
+        derived_spans.emplace_back(key_poly);
+    }
+    auto commitments = commitment_key->commit_batch(derived_spans);
+    for (auto [commitment, derived_commitment] : zip_view(witness_commitments.get_derived(), commitments)) {
+        commitment = derived_commitment;
     }
 
     // Send all commitments to the verifier
@@ -39,15 +39,17 @@ BytecodeId TxBytecodeManager::get_bytecode(const AztecAddress& address)
     info("Bytecode for ", address, " successfully retrieved!");
 
     FF bytecode_commitment = bytecode_hasher.compute_public_bytecode_commitment(bytecode_id, klass.packed_bytecode);
-    (void)bytecode_commitment; // Avoid GCC unused parameter warning when asserts are disabled.
     assert(bytecode_commitment == klass.public_bytecode_commitment);
     // We convert the bytecode to a shared_ptr because it will be shared by some events.
-    auto shared_bytecode = std::make_shared<std::vector<uint8_t>>(std::move(klass.packed_bytecode));
-    decomposition_events.emit({ .bytecode_id = bytecode_id, .bytecode = shared_bytecode });
+    // If the bytecode was seen before (possibly in another transaction), we reuse its decoded instructions. The cache
+    // is keyed by the commitment we just computed, so it never hands out instructions of different bytes.
+    auto decoded_bytecode = decoded_bytecode_cache.get_or_create(
+        bytecode_commitment, std::make_shared<std::vector<uint8_t>>(std::move(klass.packed_bytecode)));
+    decomposition_events.emit({ .bytecode_id = bytecode_id, .bytecode = decoded_bytecode->get_bytecode() });
 
     // We now save the bytecode so that we don't repeat this process.
     resolved_addresses[address] = bytecode_id;
-    bytecodes.emplace(bytecode_id, std::move(shared_bytecode));
+    bytecodes.emplace(bytecode_id, std::move(decoded_bytecode));
 
     auto tree_snapshots = merkle_db.get_tree_roots();
 
@@ -67,45 +69,35 @@ BytecodeId TxBytecodeManager::get_bytecode(const AztecAddress& address)
 
 Instruction TxBytecodeManager::read_instruction(BytecodeId bytecode_id, uint32_t pc)
 {
-    // We'll be filling in the event as we progress.
-    InstructionFetchingEvent instr_fetching_event;
-
     auto it = bytecodes.find(bytecode_id);
     if (it == bytecodes.end()) {
         throw std::runtime_error("Bytecode not found");
     }
 
-    instr_fetching_event.bytecode_id = bytecode_id;
-    instr_fetching_event.pc = pc;
-
-    auto bytecode_ptr = it->second;
-    instr_fetching_event.bytecode = bytecode_ptr;
-
-    const auto& bytecode = *bytecode_ptr;
-
     // TODO: Propagate instruction fetching error to the upper layer (execution loop)
-    try {
-        instr_fetching_event.instruction = deserialize_instruction(bytecode, pc);
-
-        // If the following code is executed, no error was thrown in deserialize_instruction().
-        if (!check_tag(instr_fetching_event.instruction)) {
-            instr_fetching_event.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
-        };
-    } catch (const InstrDeserializationError& error) {
-        assert(error != InstrDeserializationError::TAG_OUT_OF_RANGE);
-        instr_fetching_event.error = error;
+    DecodedBytecode& decoded_bytecode = *it->second;
+    const auto& decoded = decoded_bytecode.get_instruction(pc);
+
+    // Tracegen only needs one fetching event (and range check) per (bytecode id, pc), so we skip them on refetches.
+    if (!fetched_instructions.insert({ bytecode_id, pc }).second) {
+        return decoded.instruction;
     }
 
     // We are showing whether bytecode_size > pc or not. If there is no fetching error,
     // we always have bytecode_size > pc.
-    const auto bytecode_size = bytecode_ptr->size();
+    const auto bytecode_size = decoded_bytecode.get_bytecode()->size();
     const uint128_t pc_diff = bytecode_size > pc ? bytecode_size - pc - 1 : pc - bytecode_size;
     range_check.assert_range(pc_diff, AVM_PC_SIZE_IN_BITS);
 
-    // The event will be deduplicated internally.
-    fetching_events.emit(InstructionFetchingEvent(instr_fetching_event));
+    fetching_events.emit({
+        .bytecode_id = bytecode_id,
+        .pc = pc,
+        .instruction = decoded.instruction,
+        .bytecode = decoded_bytecode.get_bytecode(),
+        .error = decoded.error,
+    });
 
-    return instr_fetching_event.instruction;
+    return decoded.instruction;
 }
 
 } // namespace bb::avm2::simulation
@@ -10,12 +10,14 @@
 
 #include "barretenberg/vm2/common/aztec_types.hpp"
 #include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/common/set.hpp"
 #include "barretenberg/vm2/simulation/address_derivation.hpp"
 #include "barretenberg/vm2/simulation/bytecode_hashing.hpp"
 #include "barretenberg/vm2/simulation/class_id_derivation.hpp"
 #include "barretenberg/vm2/simulation/events/bytecode_events.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/lib/db_interfaces.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
 #include "barretenberg/vm2/simulation/lib/serialization.hpp"
 #include "barretenberg/vm2/simulation/range_check.hpp"
 #include "barretenberg/vm2/simulation/siloing.hpp"
@@ -24,7 +26,8 @@
 namespace bb::avm2::simulation {
 
 // Manages the bytecode operations of all calls in a transaction.
-// In particular, it will not duplicate hashing and decomposition.
+// In particular, it will not duplicate hashing and decomposition, and it emits only one fetching event per
+// (bytecode id, pc). Instructions are decoded once per bytecode, see DecodedBytecodeCache.
 class TxBytecodeManagerInterface {
   public:
     virtual ~TxBytecodeManagerInterface() = default;
@@ -48,7 +51,8 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
                       uint32_t current_block_number,
                       EventEmitterInterface<BytecodeRetrievalEvent>& retrieval_events,
                       EventEmitterInterface<BytecodeDecompositionEvent>& decomposition_events,
-                      EventEmitterInterface<InstructionFetchingEvent>& fetching_events)
+                      EventEmitterInterface<InstructionFetchingEvent>& fetching_events,
+                      DecodedBytecodeCache& decoded_bytecode_cache)
         : contract_db(contract_db)
         , merkle_db(merkle_db)
         , poseidon2(poseidon2)
@@ -59,6 +63,7 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
         , retrieval_events(retrieval_events)
         , decomposition_events(decomposition_events)
         , fetching_events(fetching_events)
+        , decoded_bytecode_cache(decoded_bytecode_cache)
     {}
 
     BytecodeId get_bytecode(const AztecAddress& address) override;
@@ -76,7 +81,9 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
     EventEmitterInterface<BytecodeRetrievalEvent>& retrieval_events;
     EventEmitterInterface<BytecodeDecompositionEvent>& decomposition_events;
     EventEmitterInterface<InstructionFetchingEvent>& fetching_events;
-    unordered_flat_map<BytecodeId, std::shared_ptr<std::vector<uint8_t>>> bytecodes;
+    DecodedBytecodeCache& decoded_bytecode_cache;
+    unordered_flat_map<BytecodeId, std::shared_ptr<DecodedBytecode>> bytecodes;
+    unordered_flat_set<InstructionFetchingEvent::Key> fetched_instructions;
     unordered_flat_map<AztecAddress, BytecodeId> resolved_addresses;
     BytecodeId next_bytecode_id = 0;
 };
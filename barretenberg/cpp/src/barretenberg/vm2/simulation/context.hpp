@@ -119,8 +119,9 @@ class BaseContext : public ContextInterface {
         uint32_t write_size = std::min(rd_offset + rd_size, returndata_size);
 
         std::vector<FF> retrieved_returndata;
-        for (uint32_t i = 0; i < write_size; i++) {
-            retrieved_returndata.push_back(child_memory.get(get_last_rd_offset() + i));
+        retrieved_returndata.reserve(rd_size);
+        for (const auto& value : child_memory.get_slice(get_last_rd_offset(), write_size)) {
+            retrieved_returndata.push_back(value);
         }
         retrieved_returndata.resize(rd_size);
 
@@ -238,8 +239,9 @@ class NestedContext : public BaseContext {
         uint32_t read_size = std::min(cd_offset + cd_size, calldata_size);
 
         std::vector<FF> retrieved_calldata;
-        for (uint32_t i = 0; i < read_size; i++) {
-            retrieved_calldata.push_back(parent_context.get_memory().get(parent_cd_offset + i));
+        retrieved_calldata.reserve(cd_size);
+        for (const auto& value : parent_context.get_memory().get_slice(parent_cd_offset, read_size)) {
+            retrieved_calldata.push_back(value);
         }
 
         // Pad the calldata
@@ -63,6 +63,8 @@ class ExecutionComponentsProvider : public ExecutionComponentsProviderInterface
     TxBytecodeManagerInterface& tx_bytecode_manager;
     EventEmitterInterface<MemoryEvent>& memory_events;
     const InstructionInfoDBInterface& instruction_info_db;
+    // Shared by the memories of all contexts, so that nested calls reuse the pages of finished ones.
+    std::shared_ptr<MemoryPagePool> memory_page_pool = std::make_shared<MemoryPagePool>();
 
     // Sadly someone has to own these.
     // TODO(fcarreiro): We are creating one of these per execution row and only releasing them at
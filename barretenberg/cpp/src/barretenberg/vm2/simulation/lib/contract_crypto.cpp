@@ -43,15 +43,14 @@ FF compute_public_bytecode_commitment(std::span<const uint8_t> bytecode)
     std::vector<FF> contract_bytecode_fields = encode_bytecode(bytecode);
     FF running_hash = bytecode_length_in_bytes;
     for (const auto& contract_bytecode_field : contract_bytecode_fields) {
-        running_hash = poseidon2::hash({ contract_bytecode_field, running_hash });
+        running_hash = poseidon2::hash2(contract_bytecode_field, running_hash);
     }
     return running_hash;
 }
 
 FF compute_contract_class_id(const FF& artifact_hash, const FF& private_fn_root, const FF& public_bytecode_commitment)
 {
-    return poseidon2::hash(
-        { GENERATOR_INDEX__CONTRACT_LEAF, artifact_hash, private_fn_root, public_bytecode_commitment });
+    return poseidon2::hash4(GENERATOR_INDEX__CONTRACT_LEAF, artifact_hash, private_fn_root, public_bytecode_commitment);
 }
 
 FF hash_public_keys(const PublicKeys& public_keys)
@@ -70,15 +69,15 @@ FF hash_public_keys(const PublicKeys& public_keys)
 
 FF compute_contract_address(const ContractInstance& contract_instance)
 {
-    FF salted_initialization_hash = poseidon2::hash({ GENERATOR_INDEX__PARTIAL_ADDRESS,
-                                                      contract_instance.salt,
-                                                      contract_instance.initialisation_hash,
-                                                      contract_instance.deployer_addr });
-    FF partial_address = poseidon2::hash(
-        { GENERATOR_INDEX__PARTIAL_ADDRESS, contract_instance.original_class_id, salted_initialization_hash });
+    FF salted_initialization_hash = poseidon2::hash4(GENERATOR_INDEX__PARTIAL_ADDRESS,
+                                                     contract_instance.salt,
+                                                     contract_instance.initialisation_hash,
+                                                     contract_instance.deployer_addr);
+    FF partial_address = poseidon2::hash3(
+        GENERATOR_INDEX__PARTIAL_ADDRESS, contract_instance.original_class_id, salted_initialization_hash);
 
     FF public_keys_hash = hash_public_keys(contract_instance.public_keys);
-    FF h = poseidon2::hash({ GENERATOR_INDEX__CONTRACT_ADDRESS_V1, public_keys_hash, partial_address });
+    FF h = poseidon2::hash3(GENERATOR_INDEX__CONTRACT_ADDRESS_V1, public_keys_hash, partial_address);
     // This is safe since BN254_Fr < GRUMPKIN_Fr so we know there is no modulo reduction
     grumpkin::fr h_fq = grumpkin::fr(h);
     return (grumpkin::g1::affine_one * h_fq + contract_instance.public_keys.incoming_viewing_key).x;
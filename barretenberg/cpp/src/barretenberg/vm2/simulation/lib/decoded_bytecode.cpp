@@ -0,0 +1,73 @@
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+
+#include <cassert>
+
+namespace bb::avm2::simulation {
+
+DecodedBytecode::DecodedBytecode(std::shared_ptr<std::vector<uint8_t>> bytecode)
+    : bytecode(std::move(bytecode))
+    , instructions(std::make_unique<std::atomic<DecodedInstruction*>[]>(this->bytecode->size()))
+{}
+
+DecodedBytecode::~DecodedBytecode()
+{
+    for (size_t i = 0; i < bytecode->size(); i++) {
+        delete instructions[i].load(std::memory_order_relaxed);
+    }
+}
+
+const DecodedBytecode::DecodedInstruction& DecodedBytecode::get_instruction(uint32_t pc)
+{
+    if (pc >= bytecode->size()) {
+        return pc_out_of_range;
+    }
+
+    auto& slot = instructions[pc];
+    if (const auto* decoded = slot.load(std::memory_order_acquire)) {
+        return *decoded;
+    }
+
+    // If another thread decodes the same pc concurrently, the first one to publish wins.
+    auto decoded = std::make_unique<DecodedInstruction>(decode(*bytecode, pc));
+    DecodedInstruction* expected = nullptr;
+    if (slot.compare_exchange_strong(expected, decoded.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return *decoded.release();
+    }
+    return *expected;
+}
+
+DecodedBytecode::DecodedInstruction DecodedBytecode::decode(const std::vector<uint8_t>& bytecode, uint32_t pc)
+{
+    DecodedInstruction decoded;
+    try {
+        decoded.instruction = deserialize_instruction(bytecode, pc);
+
+        // If the following code is executed, no error was thrown in deserialize_instruction().
+        if (!check_tag(decoded.instruction)) {
+            decoded.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
+        };
+    } catch (const InstrDeserializationError& error) {
+        assert(error != InstrDeserializationError::TAG_OUT_OF_RANGE);
+        decoded.error = error;
+    }
+    return decoded;
+}
+
+std::shared_ptr<DecodedBytecode> DecodedBytecodeCache::get_or_create(const FF& bytecode_commitment,
+                                                                     std::shared_ptr<std::vector<uint8_t>> bytecode)
+{
+    std::lock_guard lock(mutex);
+    auto it = decoded_bytecodes.find(bytecode_commitment);
+    if (it != decoded_bytecodes.end()) {
+        return it->second;
+    }
+    if (decoded_bytecodes.size() >= MAX_BYTECODES) {
+        // Bytecodes that are still in use are kept alive by their users.
+        decoded_bytecodes.clear();
+    }
+    auto decoded = std::make_shared<DecodedBytecode>(std::move(bytecode));
+    decoded_bytecodes.emplace(bytecode_commitment, decoded);
+    return decoded;
+}
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "barretenberg/vm2/common/aztec_types.hpp"
+#include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+
+namespace bb::avm2::simulation {
+
+// The bytecode of a contract class together with its instructions, decoded on first use.
+// An instruction is decoded at most once per pc, no matter how often (or from how many threads) it is fetched.
+class DecodedBytecode {
+  public:
+    struct DecodedInstruction {
+        Instruction instruction;
+        std::optional<InstrDeserializationError> error;
+    };
+
+    explicit DecodedBytecode(std::shared_ptr<std::vector<uint8_t>> bytecode);
+    DecodedBytecode(const DecodedBytecode&) = delete;
+    DecodedBytecode& operator=(const DecodedBytecode&) = delete;
+    ~DecodedBytecode();
+
+    const std::shared_ptr<std::vector<uint8_t>>& get_bytecode() const { return bytecode; }
+    // Returns the instruction at pc, or the error that its deserialization produced.
+    const DecodedInstruction& get_instruction(uint32_t pc);
+
+  private:
+    static DecodedInstruction decode(const std::vector<uint8_t>& bytecode, uint32_t pc);
+
+    std::shared_ptr<std::vector<uint8_t>> bytecode;
+    // One slot per byte of bytecode. Slots are published once and never change afterwards.
+    std::unique_ptr<std::atomic<DecodedInstruction*>[]> instructions;
+    DecodedInstruction pc_out_of_range = { .instruction = {}, .error = InstrDeserializationError::PC_OUT_OF_RANGE };
+};
+
+// Decoded bytecodes by bytecode commitment, so that the decoded instructions can be shared by all calls and
+// transactions that execute the same bytecode. The commitment must be computed from the bytecode itself (not taken
+// from hints), otherwise different bytecodes could end up sharing an entry.
+class DecodedBytecodeCache {
+  public:
+    // Bounds the memory held on to by the cache. Once it is full, we start over.
+    static constexpr size_t MAX_BYTECODES = 1 << 10;
+
+    std::shared_ptr<DecodedBytecode> get_or_create(const FF& bytecode_commitment,
+                                                   std::shared_ptr<std::vector<uint8_t>> bytecode);
+
+  private:
+    std::mutex mutex;
+    unordered_flat_map<FF, std::shared_ptr<DecodedBytecode>> decoded_bytecodes;
+};
+
+} // namespace bb::avm2::simulation
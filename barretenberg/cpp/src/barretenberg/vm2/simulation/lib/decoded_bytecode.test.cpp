@@ -0,0 +1,84 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+std::shared_ptr<std::vector<uint8_t>> make_bytecode(const std::vector<Instruction>& instructions)
+{
+    auto bytecode = std::make_shared<std::vector<uint8_t>>();
+    for (const auto& instruction : instructions) {
+        auto bytes = instruction.serialize();
+        bytecode->insert(bytecode->end(), bytes.begin(), bytes.end());
+    }
+    return bytecode;
+}
+
+const Instruction not8 = { .opcode = WireOpCode::NOT_8,
+                           .indirect = 5,
+                           .operands = { Operand::from<uint8_t>(123), Operand::from<uint8_t>(45) } };
+const Instruction add16 = {
+    .opcode = WireOpCode::ADD_16,
+    .indirect = 3,
+    .operands = { Operand::from<uint16_t>(1000), Operand::from<uint16_t>(1001), Operand::from<uint16_t>(1002) }
+};
+
+TEST(DecodedBytecodeTest, DecodesLikeDeserialize)
+{
+    auto bytecode = make_bytecode({ not8, add16 });
+    DecodedBytecode decoded(bytecode);
+    const auto add16_pc = static_cast<uint32_t>(not8.serialize().size());
+
+    EXPECT_EQ(decoded.get_instruction(0).instruction, not8);
+    EXPECT_EQ(decoded.get_instruction(0).error, std::nullopt);
+    EXPECT_EQ(decoded.get_instruction(add16_pc).instruction, add16);
+    // Refetching returns the same decoded instruction.
+    EXPECT_EQ(&decoded.get_instruction(add16_pc), &decoded.get_instruction(add16_pc));
+
+    // Every pc, including the ones that do not start an instruction, decodes like deserialize_instruction().
+    const auto bytecode_size = static_cast<uint32_t>(bytecode->size());
+    for (uint32_t pc = 0; pc <= bytecode_size; pc++) {
+        try {
+            EXPECT_EQ(decoded.get_instruction(pc).instruction, deserialize_instruction(*bytecode, pc));
+        } catch (const InstrDeserializationError& error) {
+            EXPECT_EQ(decoded.get_instruction(pc).error, error);
+        }
+    }
+    EXPECT_EQ(decoded.get_instruction(bytecode_size).error, InstrDeserializationError::PC_OUT_OF_RANGE);
+}
+
+TEST(DecodedBytecodeTest, ConcurrentDecoding)
+{
+    std::vector<Instruction> instructions(100, add16);
+    DecodedBytecode decoded(make_bytecode(instructions));
+    const auto size = static_cast<uint32_t>(add16.serialize().size());
+
+    parallel_for(8, [&](size_t) {
+        for (uint32_t i = 0; i < instructions.size(); i++) {
+            EXPECT_EQ(decoded.get_instruction(i * size).instruction, add16);
+        }
+    });
+}
+
+TEST(DecodedBytecodeTest, CacheSharesByBytecodeCommitment)
+{
+    DecodedBytecodeCache cache;
+    auto first = cache.get_or_create(FF(1), make_bytecode({ not8 }));
+    auto second = cache.get_or_create(FF(1), make_bytecode({ not8 }));
+    auto other = cache.get_or_create(FF(2), make_bytecode({ add16 }));
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(other->get_instruction(0).instruction, add16);
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -1,5 +1,6 @@
 #include "barretenberg/vm2/simulation/memory.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 
@@ -7,6 +8,31 @@
 #include "barretenberg/vm2/common/memory_types.hpp"
 
 namespace bb::avm2::simulation {
+namespace {
+
+const MemoryValue& default_value()
+{
+    static const auto value = MemoryValue::from<FF>(0);
+    return value;
+}
+
+// Fresh and recycled pages are copied from this one, so that every value is only written once.
+const MemoryPage& zero_page()
+{
+    static const auto page = [] {
+        auto page = std::make_unique<MemoryPage>();
+        page->values.fill(default_value());
+        return page;
+    }();
+    return *page;
+}
+
+size_t page_offset(MemoryAddress index)
+{
+    return index & (MemoryPage::SIZE - 1);
+}
+
+} // namespace
 
 bool MemoryInterface::is_valid_address(const FF& address)
 {
@@ -19,24 +45,106 @@ bool MemoryInterface::is_valid_address(const MemoryValue& address)
     return is_valid_address(address.as_ff()) && address.get_tag() == MemoryAddressTag;
 }
 
+std::vector<MemoryValue> MemoryInterface::get_slice(MemoryAddress start, uint32_t size) const
+{
+    std::vector<MemoryValue> values;
+    values.reserve(size);
+    for (uint32_t i = 0; i < size; i++) {
+        values.push_back(get(start + i));
+    }
+    return values;
+}
+
+std::unique_ptr<MemoryPage> MemoryPagePool::acquire()
+{
+    if (free_pages.empty()) {
+        return std::make_unique<MemoryPage>(zero_page());
+    }
+    auto page = std::move(free_pages.back());
+    free_pages.pop_back();
+    *page = zero_page();
+    return page;
+}
+
+void MemoryPagePool::release(std::unique_ptr<MemoryPage> page)
+{
+    if (free_pages.size() < MAX_FREE_PAGES) {
+        free_pages.push_back(std::move(page));
+    }
+}
+
+Memory::~Memory()
+{
+    for (auto& table : directory) {
+        if (table == nullptr) {
+            continue;
+        }
+        for (auto& page : *table) {
+            if (page != nullptr) {
+                page_pool->release(std::move(page));
+            }
+        }
+    }
+}
+
+const MemoryPage* Memory::find_page(MemoryAddress index) const
+{
+    const auto& table = directory[index >> (TABLE_BITS + MemoryPage::BITS)];
+    if (table == nullptr) {
+        return nullptr;
+    }
+    return (*table)[(index >> MemoryPage::BITS) & ((1 << TABLE_BITS) - 1)].get();
+}
+
+MemoryPage& Memory::get_or_create_page(MemoryAddress index)
+{
+    auto& table = directory[index >> (TABLE_BITS + MemoryPage::BITS)];
+    if (table == nullptr) {
+        table = std::make_unique<PageTable>();
+    }
+    auto& page = (*table)[(index >> MemoryPage::BITS) & ((1 << TABLE_BITS) - 1)];
+    if (page == nullptr) {
+        page = page_pool->acquire();
+    }
+    return *page;
+}
+
 void Memory::set(MemoryAddress index, MemoryValue value)
 {
     // TODO: validate tag-value makes sense.
-    memory[index] = value;
+    get_or_create_page(index).values[page_offset(index)] = value;
     debug("Memory write: ", index, " <- ", value.to_string());
     events.emit({ .mode = MemoryMode::WRITE, .addr = index, .value = value, .space_id = space_id });
 }
 
 const MemoryValue& Memory::get(MemoryAddress index) const
 {
-    static const auto default_value = MemoryValue::from<FF>(0);
-
-    auto it = memory.find(index);
-    const auto& vt = it != memory.end() ? it->second : default_value;
+    const MemoryPage* page = find_page(index);
+    const auto& vt = page != nullptr ? page->values[page_offset(index)] : default_value();
     events.emit({ .mode = MemoryMode::READ, .addr = index, .value = vt, .space_id = space_id });
 
     debug("Memory read: ", index, " -> ", vt.to_string());
     return vt;
 }
 
+std::vector<MemoryValue> Memory::get_slice(MemoryAddress start, uint32_t size) const
+{
+    std::vector<MemoryValue> values(size, default_value());
+    // Copy page by page. Page boundaries also are where addresses wrap around.
+    for (uint32_t done = 0; done < size;) {
+        const MemoryAddress index = start + done;
+        const auto count =
+            std::min<uint32_t>(size - done, static_cast<uint32_t>(MemoryPage::SIZE - page_offset(index)));
+        if (const MemoryPage* page = find_page(index)) {
+            const auto* first = page->values.begin() + page_offset(index);
+            std::copy(first, first + count, values.begin() + done);
+        }
+        done += count;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        events.emit({ .mode = MemoryMode::READ, .addr = start + i, .value = values[i], .space_id = space_id });
+    }
+    return values;
+}
+
 } // namespace bb::avm2::simulation
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
-#include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/common/memory_types.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/memory_event.hpp"
@@ -13,33 +16,77 @@ class MemoryInterface {
   public:
     virtual ~MemoryInterface() = default;
 
-    // Returned reference is only valid until the next call to set.
+    // Returned reference stays valid as long as the memory, but sees later writes to the same address.
     virtual const MemoryValue& get(MemoryAddress index) const = 0;
-    // Sets value. Invalidates all references to previous values.
+    // Sets value. Other addresses (and references to them) are not affected.
     virtual void set(MemoryAddress index, MemoryValue value) = 0;
 
+    // Bulk version of get, for calldata and returndata copies. Addresses wrap around like in get.
+    // It behaves (and emits events) exactly like a loop over get.
+    virtual std::vector<MemoryValue> get_slice(MemoryAddress start, uint32_t size) const;
+
     virtual uint32_t get_space_id() const = 0;
 
     static bool is_valid_address(const MemoryValue& address);
     static bool is_valid_address(const FF& address);
 };
 
+// A dense page of memory. Addresses that were never written to read as FF(0).
+struct MemoryPage {
+    static constexpr size_t BITS = 10;
+    static constexpr size_t SIZE = 1 << BITS;
+
+    std::array<MemoryValue, SIZE> values;
+};
+
+// Recycles memory pages across the contexts (nested calls) of a transaction. Not thread safe.
+class MemoryPagePool {
+  public:
+    // Returns a page with all values set to FF(0).
+    std::unique_ptr<MemoryPage> acquire();
+    void release(std::unique_ptr<MemoryPage> page);
+
+  private:
+    // Bounds the memory kept around for reuse.
+    static constexpr size_t MAX_FREE_PAGES = 1 << 8;
+
+    std::vector<std::unique_ptr<MemoryPage>> free_pages;
+};
+
+// Memory of a single context. The address space is covered by a two level page table whose pages are allocated on
+// first write, so accesses do not hash and values stay at the same address until the memory is destroyed.
 class Memory : public MemoryInterface {
   public:
-    Memory(uint32_t space_id, EventEmitterInterface<MemoryEvent>& event_emitter)
+    Memory(uint32_t space_id,
+           EventEmitterInterface<MemoryEvent>& event_emitter,
+           std::shared_ptr<MemoryPagePool> page_pool = std::make_shared<MemoryPagePool>())
         : space_id(space_id)
         , events(event_emitter)
+        , page_pool(std::move(page_pool))
     {}
+    Memory(const Memory&) = delete;
+    Memory& operator=(const Memory&) = delete;
+    ~Memory() override;
 
     const MemoryValue& get(MemoryAddress index) const override;
     void set(MemoryAddress index, MemoryValue value) override;
 
+    std::vector<MemoryValue> get_slice(MemoryAddress start, uint32_t size) const override;
+
     uint32_t get_space_id() const override { return space_id; }
 
   private:
+    static constexpr size_t TABLE_BITS = 11;
+    static constexpr size_t DIRECTORY_BITS = 32 - TABLE_BITS - MemoryPage::BITS;
+    using PageTable = std::array<std::unique_ptr<MemoryPage>, 1 << TABLE_BITS>;
+
+    const MemoryPage* find_page(MemoryAddress index) const;
+    MemoryPage& get_or_create_page(MemoryAddress index);
+
     uint32_t space_id;
-    unordered_flat_map<size_t, MemoryValue> memory;
     EventEmitterInterface<MemoryEvent>& events;
+    std::shared_ptr<MemoryPagePool> page_pool;
+    std::array<std::unique_ptr<PageTable>, 1 << DIRECTORY_BITS> directory;
 };
 
 } // namespace bb::avm2::simulation
@@ -0,0 +1,89 @@
+#include "barretenberg/vm2/simulation/memory.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/memory_event.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::SizeIs;
+
+TEST(MemorySimulationTest, SetAndGet)
+{
+    NoopEventEmitter<MemoryEvent> emitter;
+    Memory mem(/*space_id=*/0, emitter);
+
+    // Unwritten addresses read as FF(0), including the ones in pages that exist.
+    EXPECT_EQ(mem.get(7), MemoryValue::from<FF>(0));
+    mem.set(7, MemoryValue::from<uint32_t>(42));
+    EXPECT_EQ(mem.get(7), MemoryValue::from<uint32_t>(42));
+    EXPECT_EQ(mem.get(8), MemoryValue::from<FF>(0));
+
+    // The highest address and addresses in other page tables.
+    mem.set(UINT32_MAX, MemoryValue::from<uint8_t>(1));
+    mem.set(1 << 30, MemoryValue::from<uint16_t>(2));
+    EXPECT_EQ(mem.get(UINT32_MAX), MemoryValue::from<uint8_t>(1));
+    EXPECT_EQ(mem.get(1 << 30), MemoryValue::from<uint16_t>(2));
+    EXPECT_EQ(mem.get((1 << 30) - 1), MemoryValue::from<FF>(0));
+
+    // Writes do not move other values.
+    const auto& value = mem.get(7);
+    mem.set(MemoryPage::SIZE * 3, MemoryValue::from<uint32_t>(3));
+    EXPECT_EQ(&value, &mem.get(7));
+}
+
+TEST(MemorySimulationTest, Slices)
+{
+    EventEmitter<MemoryEvent> emitter;
+    Memory mem(/*space_id=*/5, emitter);
+
+    // A slice that crosses a page boundary and wraps around the address space.
+    const MemoryAddress start = UINT32_MAX - 1;
+    for (uint32_t i = 0; i < 3; i++) {
+        mem.set(start + i, MemoryValue::from<FF>(i + 1));
+    }
+    EXPECT_EQ(mem.get(UINT32_MAX), MemoryValue::from<FF>(2));
+    EXPECT_EQ(mem.get(0), MemoryValue::from<FF>(3));
+
+    const auto values = mem.get_slice(MemoryPage::SIZE - 2, 4);
+    const auto zero = MemoryValue::from<FF>(0);
+    EXPECT_THAT(values, ElementsAre(zero, zero, zero, zero));
+    EXPECT_THAT(mem.get_slice(start, 3),
+                ElementsAre(MemoryValue::from<FF>(1), MemoryValue::from<FF>(2), MemoryValue::from<FF>(3)));
+
+    // Slices emit the same events as the equivalent loop over get.
+    auto events = emitter.dump_events();
+    ASSERT_THAT(events, SizeIs(3 + 2 + 4 + 3));
+    EXPECT_THAT(events[2], Field(&MemoryEvent::addr, 0));
+    EXPECT_THAT(events[2], Field(&MemoryEvent::mode, MemoryMode::WRITE));
+    EXPECT_THAT(events.back(), Field(&MemoryEvent::addr, 0));
+    EXPECT_THAT(events.back(), Field(&MemoryEvent::mode, MemoryMode::READ));
+    EXPECT_THAT(events.back(), Field(&MemoryEvent::space_id, 5));
+}
+
+TEST(MemorySimulationTest, PagesAreRecycled)
+{
+    NoopEventEmitter<MemoryEvent> emitter;
+    auto pool = std::make_shared<MemoryPagePool>();
+    {
+        Memory mem(/*space_id=*/0, emitter, pool);
+        mem.set(3, MemoryValue::from<uint32_t>(42));
+    }
+    // A recycled page comes back cleared.
+    Memory mem(/*space_id=*/1, emitter, pool);
+    mem.set(0, MemoryValue::from<uint32_t>(1));
+    EXPECT_EQ(mem.get(3), MemoryValue::from<FF>(0));
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -12,7 +12,7 @@ FF Siloing::silo(const FF& generator, const FF& elem, const FF& silo_by, Siloing
 {
     // TODO: Cache and deduplicate.
     // TODO: Use poseidon gadget.
-    auto siloed_elem = Poseidon2::hash({ generator, silo_by, elem });
+    auto siloed_elem = Poseidon2::hash3(generator, silo_by, elem);
     events.emit({ .type = type, .elem = elem, .siloed_by = silo_by, .siloed_elem = siloed_elem });
     return siloed_elem;
 }
@@ -49,8 +49,8 @@ void UpdateCheck::check_current_class_id(const AztecAddress& address, const Cont
         std::vector<FF> update_preimage(3);
 
         for (size_t i = 0; i < update_preimage.size(); ++i) {
-            FF leaf_slot = UnconstrainedPoseidon2::hash(
-                { GENERATOR_INDEX__PUBLIC_LEAF_INDEX, DEPLOYER_CONTRACT_ADDRESS, shared_mutable_slot + i });
+            FF leaf_slot = UnconstrainedPoseidon2::hash3(
+                GENERATOR_INDEX__PUBLIC_LEAF_INDEX, DEPLOYER_CONTRACT_ADDRESS, shared_mutable_slot + i);
             update_preimage[i] = unconstrained_read(unconstrained_merkle_db, leaf_slot);
         }
 
@@ -34,6 +34,7 @@
 #include "barretenberg/vm2/simulation/execution.hpp"
 #include "barretenberg/vm2/simulation/execution_components.hpp"
 #include "barretenberg/vm2/simulation/field_gt.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
 #include "barretenberg/vm2/simulation/lib/instruction_info.hpp"
 #include "barretenberg/vm2/simulation/lib/raw_data_dbs.hpp"
 #include "barretenberg/vm2/simulation/merkle_check.hpp"
@@ -114,6 +115,8 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
     BytecodeHasher bytecode_hasher(poseidon2, bytecode_hashing_emitter);
     Siloing siloing(siloing_emitter);
     InstructionInfoDB instruction_info_db;
+    // Decoded instructions only depend on the bytecode, so we share them across simulations.
+    static DecodedBytecodeCache decoded_bytecode_cache;
     TxBytecodeManager bytecode_manager(contract_db,
                                        merkle_db,
                                        poseidon2,
@@ -123,7 +126,8 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
                                        current_block_number,
                                        bytecode_retrieval_emitter,
                                        bytecode_decomposition_emitter,
-                                       instruction_fetching_emitter);
+                                       instruction_fetching_emitter,
+                                       decoded_bytecode_cache);
     ExecutionComponentsProvider execution_components(bytecode_manager, memory_emitter, instruction_info_db);
 
     Alu alu(alu_emitter);
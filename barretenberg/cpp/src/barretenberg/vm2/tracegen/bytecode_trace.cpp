@@ -134,7 +134,7 @@ void BytecodeTraceBuilder::process_hashing(
         uint32_t pc_index = 0;
         FF incremental_hash = event.bytecode_length;
         for (uint32_t i = 0; i < fields.size(); i++) {
-            FF output_hash = Poseidon2::hash({ fields[i], incremental_hash });
+            FF output_hash = Poseidon2::hash2(fields[i], incremental_hash);
             bool end_of_bytecode = i == fields.size() - 1;
             trace.set(row,
                       { { { C::bc_hashing_sel, 1 },
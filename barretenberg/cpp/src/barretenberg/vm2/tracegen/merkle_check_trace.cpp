@@ -49,11 +49,11 @@ void MerkleCheckTraceBuilder::process(
             const bool index_is_even = current_index_in_layer % 2 == 0;
             const FF read_left_node = index_is_even ? read_node : sibling;
             const FF read_right_node = index_is_even ? sibling : read_node;
-            const FF read_output_hash = Poseidon2::hash({ read_left_node, read_right_node });
+            const FF read_output_hash = Poseidon2::hash2(read_left_node, read_right_node);
 
             const FF write_left_node = write ? index_is_even ? write_node : sibling : FF(0);
             const FF write_right_node = write ? index_is_even ? sibling : write_node : FF(0);
-            const FF write_output_hash = write ? Poseidon2::hash({ write_left_node, write_right_node }) : FF(0);
+            const FF write_output_hash = write ? Poseidon2::hash2(write_left_node, write_right_node) : FF(0);
 
             trace.set(row,
                       { { { C::merkle_check_sel, 1 },
@@ -1,5 +1,9 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <cstring>
+#include <stdexcept>
+#include <sys/mman.h>
+
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -11,14 +15,93 @@ namespace {
 static const FF zero = FF::zero();
 constexpr auto clk_column = Column::precomputed_clk;
 
+// Allocates zero-initialized rows. Anonymous mappings are zero-filled, so this needs no pass over the memory.
+FF* allocate_dense_rows(size_t num_rows)
+{
+    void* ptr = mmap(nullptr,
+                     num_rows * sizeof(FF),
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS,
+                     /*fd=*/-1,
+                     /*offset=*/0);
+    if (ptr == MAP_FAILED) {
+        throw std::runtime_error("Failed to allocate memory for a dense trace column");
+    }
+    return static_cast<FF*>(ptr);
+}
+
+void free_dense_rows(FF* rows, size_t num_rows)
+{
+    if (rows != nullptr) {
+        munmap(static_cast<void*>(rows), num_rows * sizeof(FF));
+    }
+}
+
 } // namespace
 
-TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
-{}
+TraceContainer::DenseColumn::~DenseColumn()
+{
+    reset();
+}
+
+FF* TraceContainer::DenseColumn::get_or_allocate_page(size_t page)
+{
+    FF* current = get_page(page);
+    if (current != nullptr) {
+        return current;
+    }
+    // Several writers might race to allocate. Only one of them wins, the rest free their allocation.
+    FF* fresh = allocate_dense_rows(DENSE_PAGE_SIZE);
+    if (pages[page].compare_exchange_strong(current, fresh, std::memory_order_acq_rel)) {
+        return fresh;
+    }
+    free_dense_rows(fresh, DENSE_PAGE_SIZE);
+    return current;
+}
+
+void TraceContainer::DenseColumn::update_max_row(uint32_t row)
+{
+    int64_t max_row = max_row_number.load(std::memory_order_relaxed);
+    while (max_row < static_cast<int64_t>(row) &&
+           !max_row_number.compare_exchange_weak(max_row, row, std::memory_order_relaxed)) {
+    }
+}
+
+void TraceContainer::DenseColumn::reset()
+{
+    for (auto& page : pages) {
+        free_dense_rows(page.exchange(nullptr, std::memory_order_acq_rel), DENSE_PAGE_SIZE);
+    }
+    {
+        std::unique_lock lock(overflow_mutex);
+        overflow_rows.clear();
+    }
+    max_row_number.store(-1, std::memory_order_relaxed);
+    row_number_dirty.store(false, std::memory_order_relaxed);
+}
+
+TraceContainer::TraceContainer(Backend backend)
+    : backend_(backend)
+{
+    if (backend_ == Backend::SPARSE) {
+        trace = std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>();
+    } else {
+        dense_trace = std::make_unique<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>();
+    }
+}
 
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
+    if (backend_ == Backend::DENSE) {
+        const auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+        if (row >= CIRCUIT_SUBGROUP_SIZE) {
+            std::shared_lock lock(column_data.overflow_mutex);
+            const auto it = column_data.overflow_rows.find(row);
+            return it == column_data.overflow_rows.end() ? zero : it->second;
+        }
+        const FF* page = column_data.get_page(row >> DENSE_PAGE_LOG_SIZE);
+        return page == nullptr ? zero : page[row & (DENSE_PAGE_SIZE - 1)];
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
     const auto it = column_data.rows.find(row);
@@ -27,6 +110,38 @@ const FF& TraceContainer::get(Column col, uint32_t row) const
 
 void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
+    if (backend_ == Backend::DENSE) {
+        auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+        if (row >= CIRCUIT_SUBGROUP_SIZE) {
+            // Same semantics as the sparse backend.
+            std::unique_lock lock(column_data.overflow_mutex);
+            if (!value.is_zero()) {
+                column_data.overflow_rows.insert_or_assign(row, value);
+                column_data.update_max_row(row);
+            } else if (column_data.overflow_rows.erase(row) > 0 &&
+                       column_data.max_row_number.load(std::memory_order_relaxed) == row) {
+                column_data.row_number_dirty.store(true, std::memory_order_relaxed);
+            }
+            return;
+        }
+        const size_t page_index = row >> DENSE_PAGE_LOG_SIZE;
+        const size_t offset = row & (DENSE_PAGE_SIZE - 1);
+        if (value.is_zero()) {
+            // Rows are zero-initialized, so there is nothing to do unless the page was written to before.
+            FF* page = column_data.get_page(page_index);
+            if (page != nullptr) {
+                page[offset] = value;
+                if (column_data.max_row_number.load(std::memory_order_relaxed) == row) {
+                    column_data.row_number_dirty.store(true, std::memory_order_relaxed);
+                }
+            }
+            return;
+        }
+        column_data.get_or_allocate_page(page_index)[offset] = value;
+        column_data.update_max_row(row);
+        return;
+    }
+
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     if (!value.is_zero()) {
@@ -51,6 +166,10 @@ void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> va
 
 void TraceContainer::reserve_column(Column col, size_t size)
 {
+    if (backend_ == Backend::DENSE) {
+        // Dense columns allocate their pages on first write.
+        return;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     column_data.rows.reserve(size);
@@ -58,6 +177,34 @@ void TraceContainer::reserve_column(Column col, size_t size)
 
 uint32_t TraceContainer::get_column_rows(Column col) const
 {
+    if (backend_ == Backend::DENSE) {
+        auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+        int64_t max_row = column_data.max_row_number.load(std::memory_order_relaxed);
+        if (column_data.row_number_dirty.exchange(false, std::memory_order_acq_rel)) {
+            // Trigger recalculation of max row number. Overflow rows are never zero, so if there are any, the largest
+            // one is the answer. Otherwise we walk back until we find a non-zero row.
+            {
+                std::shared_lock lock(column_data.overflow_mutex);
+                auto keys = std::views::keys(column_data.overflow_rows);
+                const auto it = std::max_element(keys.begin(), keys.end());
+                max_row = it == keys.end() ? std::min<int64_t>(max_row, CIRCUIT_SUBGROUP_SIZE - 1)
+                                           : static_cast<int64_t>(*it);
+            }
+            while (max_row >= 0 && max_row < static_cast<int64_t>(CIRCUIT_SUBGROUP_SIZE)) {
+                const auto page_index = static_cast<size_t>(max_row) >> DENSE_PAGE_LOG_SIZE;
+                const FF* page = column_data.get_page(page_index);
+                if (page == nullptr) {
+                    max_row = static_cast<int64_t>(page_index * DENSE_PAGE_SIZE) - 1;
+                } else if (page[static_cast<size_t>(max_row) & (DENSE_PAGE_SIZE - 1)].is_zero()) {
+                    max_row--;
+                } else {
+                    break;
+                }
+            }
+            column_data.max_row_number.store(max_row, std::memory_order_relaxed);
+        }
+        return static_cast<uint32_t>(max_row + 1);
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     if (column_data.row_number_dirty) {
@@ -89,6 +236,31 @@ uint32_t TraceContainer::get_num_rows() const
 
 void TraceContainer::visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const
 {
+    if (backend_ == Backend::DENSE) {
+        const auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+        const int64_t max_row = column_data.max_row_number.load(std::memory_order_relaxed);
+        if (max_row < 0) {
+            return;
+        }
+        const auto last_page = std::min(static_cast<size_t>(max_row) >> DENSE_PAGE_LOG_SIZE, DENSE_NUM_PAGES - 1);
+        for (size_t page_index = 0; page_index <= last_page; ++page_index) {
+            const FF* page = column_data.get_page(page_index);
+            if (page == nullptr) {
+                continue;
+            }
+            const auto page_start = static_cast<uint32_t>(page_index * DENSE_PAGE_SIZE);
+            for (uint32_t offset = 0; offset < DENSE_PAGE_SIZE; ++offset) {
+                if (!page[offset].is_zero()) {
+                    visitor(page_start + offset, page[offset]);
+                }
+            }
+        }
+        std::shared_lock lock(column_data.overflow_mutex);
+        for (const auto& [row, value] : column_data.overflow_rows) {
+            visitor(row, value);
+        }
+        return;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
     for (const auto& [row, value] : column_data.rows) {
@@ -98,6 +270,10 @@ void TraceContainer::visit_column(Column col, const std::function<void(uint32_t,
 
 void TraceContainer::clear_column(Column col)
 {
+    if (backend_ == Backend::DENSE) {
+        (*dense_trace)[static_cast<size_t>(col)].reset();
+        return;
+    }
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     column_data.rows.clear();
@@ -105,4 +281,43 @@ void TraceContainer::clear_column(Column col)
     column_data.row_number_dirty = false;
 }
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+std::shared_ptr<FF[]> TraceContainer::release_column(Column col)
+{
+    if (backend_ != Backend::DENSE) {
+        return nullptr;
+    }
+    const size_t num_rows = get_column_rows(col);
+    auto& column_data = (*dense_trace)[static_cast<size_t>(col)];
+    if (num_rows == 0) {
+        column_data.reset();
+        return nullptr;
+    }
+    // Columns that fit in their first page (the common case) are handed over without copying.
+    if (num_rows <= DENSE_PAGE_SIZE) {
+        FF* page = column_data.pages[0].exchange(nullptr, std::memory_order_acq_rel);
+        column_data.reset();
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        return std::shared_ptr<FF[]>(page, [](FF* rows) { free_dense_rows(rows, DENSE_PAGE_SIZE); });
+    }
+    // Otherwise the pages are gathered into one buffer, sized by the rows of the column.
+    const size_t buffer_rows = (num_rows + DENSE_PAGE_SIZE - 1) & ~(DENSE_PAGE_SIZE - 1);
+    FF* rows = allocate_dense_rows(buffer_rows);
+    const size_t num_pages = std::min(buffer_rows / DENSE_PAGE_SIZE, DENSE_NUM_PAGES);
+    for (size_t page_index = 0; page_index < num_pages; ++page_index) {
+        if (const FF* page = column_data.get_page(page_index); page != nullptr) {
+            std::memcpy(static_cast<void*>(rows + page_index * DENSE_PAGE_SIZE), page, DENSE_PAGE_SIZE * sizeof(FF));
+        }
+    }
+    {
+        std::shared_lock lock(column_data.overflow_mutex);
+        for (const auto& [row, value] : column_data.overflow_rows) {
+            rows[row] = value;
+        }
+    }
+    column_data.reset();
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    return std::shared_ptr<FF[]>(rows, [buffer_rows](FF* rows) { free_dense_rows(rows, buffer_rows); });
+}
+
 } // namespace bb::avm2::tracegen
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -9,6 +10,7 @@
 #include <span>
 #include <unordered_map>
 
+#include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
@@ -19,9 +21,18 @@ namespace bb::avm2::tracegen {
 
 // This container is thread-safe.
 // Contention can only happen when concurrently accessing the same column.
+//
+// Two storage backends are available:
+// - SPARSE: each column is a hash map from row to value, behind a mutex.
+// - DENSE: each column is a table of fixed-size pages of rows, a page being allocated on the first write to one of its
+//   rows. Memory is only allocated for the parts of a column that are written to. Writes to disjoint rows of the same
+//   column are lock-free and a column can be handed over as one row-contiguous buffer (see release_column). Rows beyond
+//   CIRCUIT_SUBGROUP_SIZE are accepted as by the sparse backend, and kept in a sparse overflow map.
 class TraceContainer {
   public:
-    TraceContainer();
+    enum class Backend { SPARSE, DENSE };
+
+    explicit TraceContainer(Backend backend = Backend::SPARSE);
 
     const FF& get(Column col, uint32_t row) const;
     template <size_t N> std::array<FF, N> get_multiple(const std::array<ColumnAndShifts, N>& cols, uint32_t row) const
@@ -57,8 +68,18 @@ class TraceContainer {
 
     // Free column memory.
     void clear_column(Column col);
+    // Hands over the values of a dense column as row-contiguous memory and clears the column.
+    // Element i of the returned buffer holds row i, for all i < get_column_rows(col) (as called before releasing), and
+    // the buffer is padded with zeroes to a whole number of pages.
+    // Returns nullptr for the sparse backend or if the column is empty.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<FF[]> release_column(Column col);
+
+    Backend backend() const { return backend_; }
 
   private:
+    Backend backend_;
+
     // We use a mutex per column to allow for concurrent writes.
     // Observe that therefore concurrent write access to different columns is cheap.
     struct SparseColumn {
@@ -75,6 +96,36 @@ class TraceContainer {
     // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
     // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
     std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+
+    // Rows per page. Pages are the granularity at which memory is allocated for a dense column.
+    static constexpr size_t DENSE_PAGE_LOG_SIZE = 12;
+    static constexpr size_t DENSE_PAGE_SIZE = 1UL << DENSE_PAGE_LOG_SIZE;
+    static constexpr size_t DENSE_NUM_PAGES = CIRCUIT_SUBGROUP_SIZE / DENSE_PAGE_SIZE;
+    static_assert(CIRCUIT_SUBGROUP_SIZE % DENSE_PAGE_SIZE == 0);
+
+    // Rows below CIRCUIT_SUBGROUP_SIZE are accessed through atomics only, so that writers to disjoint rows never need
+    // to synchronize. Rows beyond go to the overflow map, under its mutex.
+    struct DenseColumn {
+        // Allocated lazily, on the first write to one of its rows. Each page holds DENSE_PAGE_SIZE zero-initialized
+        // rows.
+        std::array<std::atomic<FF*>, DENSE_NUM_PAGES> pages = {};
+        std::atomic<int64_t> max_row_number = -1; // We use -1 to indicate that the column is empty.
+        std::atomic<bool> row_number_dirty = false;
+        mutable std::shared_mutex overflow_mutex;
+        unordered_flat_map<uint32_t, FF> overflow_rows;
+
+        DenseColumn() = default;
+        DenseColumn(const DenseColumn&) = delete;
+        DenseColumn& operator=(const DenseColumn&) = delete;
+        ~DenseColumn();
+
+        FF* get_page(size_t page) const { return pages[page].load(std::memory_order_acquire); }
+        FF* get_or_allocate_page(size_t page);
+        void update_max_row(uint32_t row);
+        // Resets the column to empty, freeing its memory.
+        void reset();
+    };
+    std::unique_ptr<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> dense_trace;
 };
 
 } // namespace bb::avm2::tracegen
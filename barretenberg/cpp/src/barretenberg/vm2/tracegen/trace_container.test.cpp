@@ -0,0 +1,151 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using testing::ElementsAre;
+using testing::Pair;
+
+using C = Column;
+using Backend = TraceContainer::Backend;
+
+std::map<uint32_t, FF> collect(const TraceContainer& trace, Column col)
+{
+    std::map<uint32_t, FF> result;
+    trace.visit_column(col, [&](uint32_t row, const FF& value) { result.emplace(row, value); });
+    return result;
+}
+
+class TraceContainerTest : public testing::TestWithParam<Backend> {};
+
+TEST_P(TraceContainerTest, SetGetAndVisit)
+{
+    TraceContainer trace(GetParam());
+
+    EXPECT_EQ(trace.get(C::execution_sel, 5), FF(0));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+
+    trace.set(C::execution_sel, 5, FF(7));
+    trace.set(C::execution_sel, 70000, FF(9));
+    trace.set(5, std::vector<std::pair<Column, FF>>{ { C::execution_clk, FF(1) }, { C::execution_sel, FF(8) } });
+
+    EXPECT_EQ(trace.get(C::execution_sel, 5), FF(8));
+    EXPECT_EQ(trace.get(C::execution_sel, 6), FF(0));
+    EXPECT_EQ(trace.get(C::execution_clk, 5), FF(1));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 70001);
+    EXPECT_EQ(trace.get_num_rows_without_clk(), 70001);
+    EXPECT_THAT(collect(trace, C::execution_sel), ElementsAre(Pair(5, FF(8)), Pair(70000, FF(9))));
+
+    // Zeroing the last row shrinks the column.
+    trace.set(C::execution_sel, 70000, FF(0));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 6);
+    EXPECT_THAT(collect(trace, C::execution_sel), ElementsAre(Pair(5, FF(8))));
+
+    trace.clear_column(C::execution_sel);
+    EXPECT_EQ(trace.get(C::execution_sel, 5), FF(0));
+    EXPECT_THAT(collect(trace, C::execution_sel), ElementsAre());
+}
+
+TEST_P(TraceContainerTest, ConcurrentDisjointWrites)
+{
+    TraceContainer trace(GetParam());
+    constexpr uint32_t num_rows = 1 << 16;
+
+    parallel_for(8, [&](size_t thread) {
+        for (uint32_t row = static_cast<uint32_t>(thread); row < num_rows; row += 8) {
+            trace.set(C::execution_sel, row, FF(row + 1));
+        }
+    });
+
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows);
+    for (uint32_t row = 0; row < num_rows; row++) {
+        EXPECT_EQ(trace.get(C::execution_sel, row), FF(row + 1));
+    }
+}
+
+TEST_P(TraceContainerTest, RowsBeyondSubgroupSize)
+{
+    TraceContainer trace(GetParam());
+    constexpr uint32_t row = CIRCUIT_SUBGROUP_SIZE + 3;
+
+    trace.set(C::execution_sel, 5, FF(7));
+    trace.set(C::execution_sel, row, FF(9));
+    EXPECT_EQ(trace.get(C::execution_sel, row), FF(9));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), row + 1);
+    EXPECT_THAT(collect(trace, C::execution_sel), ElementsAre(Pair(5, FF(7)), Pair(row, FF(9))));
+
+    trace.set(C::execution_sel, row, FF(0));
+    EXPECT_EQ(trace.get(C::execution_sel, row), FF(0));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 6);
+    EXPECT_THAT(collect(trace, C::execution_sel), ElementsAre(Pair(5, FF(7))));
+}
+
+INSTANTIATE_TEST_SUITE_P(TraceContainerTest,
+                         TraceContainerTest,
+                         testing::Values(Backend::SPARSE, Backend::DENSE),
+                         [](const auto& info) { return info.param == Backend::SPARSE ? "Sparse" : "Dense"; });
+
+TEST(TraceContainerTest, DenseReleaseColumn)
+{
+    TraceContainer trace(Backend::DENSE);
+    trace.set(C::execution_sel, 3, FF(4));
+    trace.set(C::execution_sel, 10, FF(11));
+
+    auto rows = trace.release_column(C::execution_sel);
+    ASSERT_NE(rows, nullptr);
+    EXPECT_EQ(rows[0], FF(0));
+    EXPECT_EQ(rows[3], FF(4));
+    EXPECT_EQ(rows[10], FF(11));
+
+    // The column is empty after the handover.
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+    EXPECT_EQ(trace.get(C::execution_sel, 3), FF(0));
+    EXPECT_EQ(trace.release_column(C::execution_sel), nullptr);
+}
+
+TEST(TraceContainerTest, DenseReleaseColumnSpanningPages)
+{
+    TraceContainer trace(Backend::DENSE);
+    trace.set(C::execution_sel, 3, FF(4));
+    trace.set(C::execution_sel, 20000, FF(5));
+    // Zeroed rows do not count.
+    trace.set(C::execution_sel, 30000, FF(6));
+    trace.set(C::execution_sel, 30000, FF(0));
+
+    auto rows = trace.release_column(C::execution_sel);
+    ASSERT_NE(rows, nullptr);
+    for (uint32_t row = 0; row <= 20000; row++) {
+        EXPECT_EQ(rows[row], row == 3 ? FF(4) : (row == 20000 ? FF(5) : FF(0)));
+    }
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+}
+
+TEST(TraceContainerTest, DenseReleaseZeroedColumnIsNull)
+{
+    TraceContainer trace(Backend::DENSE);
+    trace.set(C::execution_sel, 3, FF(4));
+    trace.set(C::execution_sel, 3, FF(0));
+    EXPECT_EQ(trace.release_column(C::execution_sel), nullptr);
+}
+
+TEST(TraceContainerTest, SparseReleaseColumnIsNull)
+{
+    TraceContainer trace(Backend::SPARSE);
+    trace.set(C::execution_sel, 3, FF(4));
+    EXPECT_EQ(trace.release_column(C::execution_sel), nullptr);
+    EXPECT_EQ(trace.get(C::execution_sel, 3), FF(4));
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
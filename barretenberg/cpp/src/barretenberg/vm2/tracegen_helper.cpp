@@ -170,7 +170,8 @@ void check_interactions([[maybe_unused]] const TraceContainer& trace)
 
 TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events)
 {
-    TraceContainer trace;
+    // The dense backend lets compute_polynomials take over the columns without copying them.
+    TraceContainer trace(TraceContainer::Backend::DENSE);
 
     // We process the events in parallel. Ideally the jobs should access disjoint column sets.
     {
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
@@ -31,6 +32,15 @@ std::string getMerkleTreeName(MerkleTreeId id);
 using TreeStateReference = std::pair<bb::fr, bb::crypto::merkle_tree::index_t>;
 using StateReference = std::unordered_map<MerkleTreeId, TreeStateReference>;
 
+// The side effects of a transaction, as inserted into the trees by the block builder
+struct TxSideEffects {
+    std::vector<bb::fr> note_hashes;
+    std::vector<crypto::merkle_tree::NullifierLeafValue> nullifiers;
+    std::vector<crypto::merkle_tree::PublicDataLeafValue> public_data_writes;
+
+    MSGPACK_FIELDS(note_hashes, nullifiers, public_data_writes);
+};
+
 struct WorldStateRevision {
     index_t forkId{ 0 };
     block_number_t blockNumber{ 0 };
@@ -9,6 +9,8 @@
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/lmdblib/lmdb_helpers.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/vm2/common/aztec_constants.hpp"
 #include "barretenberg/world_state/fork.hpp"
 #include "barretenberg/world_state/tree_with_store.hpp"
@@ -19,11 +21,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -456,6 +460,38 @@ fr_sibling_path WorldState::get_sibling_path(const WorldStateRevision& revision,
         fork->_trees.at(tree_id));
 }
 
+std::vector<fr_sibling_path> WorldState::get_sibling_paths(const WorldStateRevision& revision,
+                                                          MerkleTreeId tree_id,
+                                                          const std::vector<index_t>& leaf_indices) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+
+    return std::visit(
+        [&leaf_indices, revision](auto&& wrapper) {
+            Signal signal(1);
+            TypedResponse<GetSiblingPathsResponse> local;
+
+            auto callback = [&signal, &local](TypedResponse<GetSiblingPathsResponse>& response) {
+                local = std::move(response);
+                signal.signal_level(0);
+            };
+
+            if (revision.blockNumber) {
+                wrapper.tree->get_sibling_paths(
+                    leaf_indices, revision.blockNumber, callback, revision.includeUncommitted);
+            } else {
+                wrapper.tree->get_sibling_paths(leaf_indices, callback, revision.includeUncommitted);
+            }
+            signal.wait_for_level(0);
+
+            if (!local.success) {
+                throw std::runtime_error(local.message);
+            }
+            return std::move(local.inner.paths);
+        },
+        fork->_trees.at(tree_id));
+}
+
 void WorldState::get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                                     MerkleTreeId tree_id,
                                                     const std::vector<index_t>& leafIndices,
@@ -514,6 +550,131 @@ void WorldState::update_archive(const StateReference& block_state_ref,
     }
 }
 
+BlockInsertionResult WorldState::insert_block_side_effects(const std::vector<bb::fr>& l1_to_l2_messages,
+                                                           const std::vector<TxSideEffects>& txs,
+                                                           Fork::Id fork_id)
+{
+    auto get_subtree_depth = [](size_t num_leaves, const std::string& name) {
+        if (!numeric::is_power_of_two(num_leaves)) {
+            throw std::runtime_error("Can't insert block side effects: number of " + name +
+                                     " must be a power of two, got " + std::to_string(num_leaves));
+        }
+        return static_cast<uint32_t>(numeric::get_msb(num_leaves));
+    };
+    const uint32_t message_subtree_depth = get_subtree_depth(l1_to_l2_messages.size(), "L1 to L2 messages");
+    std::vector<uint32_t> note_hash_subtree_depths;
+    std::vector<uint32_t> nullifier_subtree_depths;
+    for (const auto& tx : txs) {
+        note_hash_subtree_depths.push_back(get_subtree_depth(tx.note_hashes.size(), "note hashes"));
+        nullifier_subtree_depths.push_back(get_subtree_depth(tx.nullifiers.size(), "nullifiers"));
+    }
+
+    Fork::SharedPtr fork = retrieve_fork(fork_id);
+    auto& message_tree = *std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE)).tree;
+    auto& note_hash_tree = *std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::NOTE_HASH_TREE)).tree;
+    auto& nullifier_tree = *std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE)).tree;
+    auto& public_data_tree =
+        *std::get<TreeWithStore<PublicDataTree>>(fork->_trees.at(MerkleTreeId::PUBLIC_DATA_TREE)).tree;
+
+    BlockInsertionResult result;
+    result.tx_results.resize(txs.size());
+
+    // One chain of insertions per tree, each step is started from the completion callback of the previous one
+    Signal signal(4);
+    std::atomic_bool success = true;
+    std::string err_message;
+    auto check = [&success, &err_message](const auto& response) {
+        // take the first error
+        bool expected = true;
+        if (!response.success && success.compare_exchange_strong(expected, false)) {
+            err_message = response.message;
+        }
+        return response.success;
+    };
+
+    message_tree.get_subtree_sibling_path(
+        message_subtree_depth,
+        [&](TypedResponse<GetSiblingPathResponse>& response) {
+            if (!check(response)) {
+                signal.signal_decrement();
+                return;
+            }
+            result.l1_to_l2_message_subtree_path = std::move(response.inner.path);
+            message_tree.add_values(l1_to_l2_messages, [&](const auto& add_response) {
+                check(add_response);
+                signal.signal_decrement();
+            });
+        },
+        true);
+
+    std::function<void(size_t)> insert_note_hashes = [&](size_t i) {
+        if (i == txs.size() || !success) {
+            signal.signal_decrement();
+            return;
+        }
+        note_hash_tree.get_subtree_sibling_path(
+            note_hash_subtree_depths[i],
+            [&, i](TypedResponse<GetSiblingPathResponse>& response) {
+                if (!check(response)) {
+                    signal.signal_decrement();
+                    return;
+                }
+                result.tx_results[i].note_hash_subtree_path = std::move(response.inner.path);
+                note_hash_tree.add_values(txs[i].note_hashes, [&, i](const auto& add_response) {
+                    check(add_response);
+                    insert_note_hashes(i + 1);
+                });
+            },
+            true);
+    };
+
+    std::function<void(size_t)> insert_nullifiers = [&](size_t i) {
+        if (i == txs.size() || !success) {
+            signal.signal_decrement();
+            return;
+        }
+        nullifier_tree.add_or_update_values(
+            txs[i].nullifiers,
+            nullifier_subtree_depths[i],
+            [&, i](const TypedResponse<AddIndexedDataResponse<NullifierLeafValue>>& response) {
+                if (check(response)) {
+                    auto& insertion = result.tx_results[i].nullifier_insertion;
+                    insertion.low_leaf_witness_data = *response.inner.low_leaf_witness_data;
+                    insertion.sorted_leaves = *response.inner.sorted_leaves;
+                    insertion.subtree_path = response.inner.subtree_path;
+                }
+                insert_nullifiers(i + 1);
+            });
+    };
+
+    std::function<void(size_t)> insert_public_data = [&](size_t i) {
+        if (i == txs.size() || !success) {
+            signal.signal_decrement();
+            return;
+        }
+        public_data_tree.add_or_update_values_sequentially(
+            txs[i].public_data_writes,
+            [&, i](const TypedResponse<AddIndexedDataSequentiallyResponse<PublicDataLeafValue>>& response) {
+                if (check(response)) {
+                    auto& insertion = result.tx_results[i].public_data_insertion;
+                    insertion.low_leaf_witness_data = *response.inner.low_leaf_witness_data;
+                    insertion.insertion_witness_data = *response.inner.insertion_witness_data;
+                }
+                insert_public_data(i + 1);
+            });
+    };
+
+    insert_note_hashes(0);
+    insert_nullifiers(0);
+    insert_public_data(0);
+    signal.wait_for_level();
+
+    if (!success) {
+        throw std::runtime_error("Failed to insert block side effects: " + err_message);
+    }
+    return result;
+}
+
 std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during commit
@@ -673,6 +834,162 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
     return status;
 }
 
+WorldStateStatusFull WorldState::sync_blocks(const std::vector<SyncBlockData>& blocks)
+{
+    if (blocks.empty()) {
+        throw std::runtime_error("Can't synch blocks: no blocks given");
+    }
+    validate_trees_are_equally_synched();
+    WorldStateStatusFull status;
+    Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
+
+    // inserted[k] is signalled once every tree has inserted blocks[k] (or failed to). The extra signal at the end is
+    // for the commit of the last block.
+    std::vector<Signal> inserted(blocks.size() + 1, Signal(static_cast<uint32_t>(fork->_trees.size())));
+    std::atomic_bool success = true;
+    std::string err_message;
+    auto check = [&success, &err_message](bool ok, const std::string& message) {
+        // take the first error
+        bool expected = true;
+        if (!ok && success.compare_exchange_strong(expected, false)) {
+            err_message = message;
+        }
+        return ok;
+    };
+    std::function<void(MerkleTreeId, size_t)> insert_block = [&](MerkleTreeId id, size_t k) {
+        add_block_to_tree(fork, id, blocks[k], [&, k](bool ok, const std::string& message) {
+            check(ok, message);
+            inserted[k].signal_decrement();
+        });
+    };
+
+    // As with sync_block, the first block may already be in the uncommitted state if we built it ourselves
+    if (is_same_state_reference(WorldStateRevision::uncommitted(), blocks.front().block_state_ref) &&
+        is_archive_tip(WorldStateRevision::uncommitted(), blocks.front().block_header_hash)) {
+        inserted[0].signal_level(0);
+    } else {
+        rollback();
+        for (const auto& entry : fork->_trees) {
+            insert_block(entry.first, 0);
+        }
+    }
+
+    for (size_t k = 0;; k++) {
+        // Once a block is inserted (or has failed to) all trees are idle until we commit it
+        inserted[k].wait_for_level();
+        if (!success) {
+            throw std::runtime_error("Failed to sync block: " + err_message);
+        }
+        if (k == blocks.size()) {
+            break;
+        }
+
+        if (!is_archive_tip(WorldStateRevision::uncommitted(), blocks[k].block_header_hash)) {
+            throw std::runtime_error("Can't synch block: block header hash is not the tip of the archive tree");
+        }
+
+        if (!is_same_state_reference(WorldStateRevision::uncommitted(), blocks[k].block_state_ref)) {
+            throw std::runtime_error("Can't synch block: block state does not match world state");
+        }
+
+        // Every tree moves on to the next block as soon as it has committed this one
+        for (const auto& entry : fork->_trees) {
+            const MerkleTreeId id = entry.first;
+            commit_block_to_tree(fork, id, status, [&, id, k](bool ok, const std::string& message) {
+                if (check(ok, message) && k + 1 < blocks.size()) {
+                    insert_block(id, k + 1);
+                } else {
+                    inserted[k + 1].signal_decrement();
+                }
+            });
+        }
+    }
+
+    populate_status_summary(status);
+    return status;
+}
+
+void WorldState::add_block_to_tree(const Fork::SharedPtr& fork,
+                                   MerkleTreeId id,
+                                   const SyncBlockData& block,
+                                   const std::function<void(bool, const std::string&)>& on_completion)
+{
+    auto completion = [on_completion](const auto& response) { on_completion(response.success, response.message); };
+    switch (id) {
+    case MerkleTreeId::NULLIFIER_TREE: {
+        auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(id));
+        wrapper.tree->add_or_update_values(block.nullifiers, 0, NullifierTree::AddCompletionCallback(completion));
+        break;
+    }
+    case MerkleTreeId::NOTE_HASH_TREE: {
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(id));
+        wrapper.tree->add_values(block.notes, completion);
+        break;
+    }
+    case MerkleTreeId::PUBLIC_DATA_TREE: {
+        auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(fork->_trees.at(id));
+        wrapper.tree->add_or_update_values_sequentially(block.public_writes,
+                                                        PublicDataTree::AddCompletionCallback(completion));
+        break;
+    }
+    case MerkleTreeId::L1_TO_L2_MESSAGE_TREE: {
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(id));
+        wrapper.tree->add_values(block.l1_to_l2_messages, completion);
+        break;
+    }
+    case MerkleTreeId::ARCHIVE: {
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(id));
+        wrapper.tree->add_value(block.block_header_hash, completion);
+        break;
+    }
+    default:
+        throw std::invalid_argument("Unknown MerkleTreeId");
+    }
+}
+
+void WorldState::commit_block_to_tree(const Fork::SharedPtr& fork,
+                                      MerkleTreeId id,
+                                      WorldStateStatusFull& status,
+                                      const std::function<void(bool, const std::string&)>& on_completion)
+{
+    TreeDBStats* db_stats = nullptr;
+    TreeMeta* meta = nullptr;
+    switch (id) {
+    case MerkleTreeId::NULLIFIER_TREE:
+        db_stats = &status.dbStats.nullifierTreeStats;
+        meta = &status.meta.nullifierTreeMeta;
+        break;
+    case MerkleTreeId::NOTE_HASH_TREE:
+        db_stats = &status.dbStats.noteHashTreeStats;
+        meta = &status.meta.noteHashTreeMeta;
+        break;
+    case MerkleTreeId::PUBLIC_DATA_TREE:
+        db_stats = &status.dbStats.publicDataTreeStats;
+        meta = &status.meta.publicDataTreeMeta;
+        break;
+    case MerkleTreeId::L1_TO_L2_MESSAGE_TREE:
+        db_stats = &status.dbStats.messageTreeStats;
+        meta = &status.meta.messageTreeMeta;
+        break;
+    case MerkleTreeId::ARCHIVE:
+        db_stats = &status.dbStats.archiveTreeStats;
+        meta = &status.meta.archiveTreeMeta;
+        break;
+    default:
+        throw std::invalid_argument("Unknown MerkleTreeId");
+    }
+
+    std::visit(
+        [&](auto&& wrapper) {
+            wrapper.tree->commit([db_stats, meta, on_completion](TypedResponse<CommitResponse>& response) {
+                *db_stats = std::move(response.inner.stats);
+                *meta = std::move(response.inner.meta);
+                on_completion(response.success, response.message);
+            });
+        },
+        fork->_trees.at(id));
+}
+
 GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevision& revision,
                                                           MerkleTreeId tree_id,
                                                           const bb::fr& leaf_key) const
@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -48,6 +49,33 @@ template <typename LeafValueType> struct SequentialInsertionResult {
     MSGPACK_FIELDS(low_leaf_witness_data, insertion_witness_data);
 };
 
+struct TxInsertionResult {
+    // Sibling path of the subtree that the note hashes of the transaction were appended as
+    crypto::merkle_tree::fr_sibling_path note_hash_subtree_path;
+    BatchInsertionResult<crypto::merkle_tree::NullifierLeafValue> nullifier_insertion;
+    SequentialInsertionResult<crypto::merkle_tree::PublicDataLeafValue> public_data_insertion;
+
+    MSGPACK_FIELDS(note_hash_subtree_path, nullifier_insertion, public_data_insertion);
+};
+
+struct BlockInsertionResult {
+    // Sibling path of the subtree that the L1 to L2 messages of the block were appended as
+    crypto::merkle_tree::fr_sibling_path l1_to_l2_message_subtree_path;
+    std::vector<TxInsertionResult> tx_results;
+
+    MSGPACK_FIELDS(l1_to_l2_message_subtree_path, tx_results);
+};
+
+// Everything sync_block needs to know about a block
+struct SyncBlockData {
+    StateReference block_state_ref;
+    bb::fr block_header_hash;
+    std::vector<bb::fr> notes;
+    std::vector<bb::fr> l1_to_l2_messages;
+    std::vector<crypto::merkle_tree::NullifierLeafValue> nullifiers;
+    std::vector<crypto::merkle_tree::PublicDataLeafValue> public_writes;
+};
+
 const uint64_t DEFAULT_MIN_NUMBER_OF_READERS = 128;
 
 /**
@@ -132,6 +160,18 @@ class WorldState {
                                                           MerkleTreeId tree_id,
                                                           index_t leaf_index) const;
 
+    /**
+     * @brief Get the sibling paths for a number of leaves in a tree, read together in one transaction
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return std::vector<crypto::merkle_tree::fr_sibling_path> The paths, in the order of leaf_indices
+     */
+    std::vector<crypto::merkle_tree::fr_sibling_path> get_sibling_paths(const WorldStateRevision& revision,
+                                                                       MerkleTreeId tree_id,
+                                                                       const std::vector<index_t>& leaf_indices) const;
+
     void get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                             MerkleTreeId tree_id,
                                             const std::vector<index_t>& leafIndices,
@@ -229,6 +269,21 @@ class WorldState {
                                                        const std::vector<T>& leaves,
                                                        Fork::Id fork_id = CANONICAL_FORK_ID);
 
+    /**
+     * @brief Inserts the side effects of all transactions of a block, returning the witnesses of every insertion.
+     * @details The note hash, nullifier, public data and L1 to L2 message trees do not depend on each other, so they
+     * are all written concurrently. Within each tree, the transactions are inserted in order. The L1 to L2 messages and
+     * the note hashes and nullifiers of every transaction must be padded to a power of two, which is the size of the
+     * subtree they are inserted as.
+     *
+     * @param l1_to_l2_messages The L1 to L2 messages of the block, appended before the transactions.
+     * @param txs The side effects of the transactions, in block order.
+     * @return BlockInsertionResult
+     */
+    BlockInsertionResult insert_block_side_effects(const std::vector<bb::fr>& l1_to_l2_messages,
+                                                   const std::vector<TxSideEffects>& txs,
+                                                   Fork::Id fork_id = CANONICAL_FORK_ID);
+
     /**
      * @brief Updates a leaf in an existing Merkle Tree.
      *
@@ -272,6 +327,13 @@ class WorldState {
                                     const std::vector<bb::fr>& l1_to_l2_messages,
                                     const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
                                     const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes);
+    /**
+     * @brief Syncs a sequence of blocks, with the same result as calling sync_block for each of them.
+     * @details Every tree moves on to inserting block k+1 as soon as it has committed block k, so the LMDB commit of a
+     * block on one tree overlaps with the in-memory insertion of the next block on the others. A block is only
+     * committed once all trees have inserted it and it has been checked against its state reference.
+     */
+    WorldStateStatusFull sync_blocks(const std::vector<SyncBlockData>& blocks);
 
     void checkpoint(const uint64_t& forkId);
     void commit_checkpoint(const uint64_t& forkId);
@@ -325,6 +387,17 @@ class WorldState {
 
     static void populate_status_summary(WorldStateStatusFull& status);
 
+    // Inserts the leaves that the block adds to the given tree, then calls on_completion with the outcome
+    static void add_block_to_tree(const Fork::SharedPtr& fork,
+                                  MerkleTreeId id,
+                                  const SyncBlockData& block,
+                                  const std::function<void(bool, const std::string&)>& on_completion);
+    // Commits the given tree, recording its stats and meta in status, then calls on_completion with the outcome
+    static void commit_block_to_tree(const Fork::SharedPtr& fork,
+                                     MerkleTreeId id,
+                                     WorldStateStatusFull& status,
+                                     const std::function<void(bool, const std::string&)>& on_completion);
+
     template <typename TreeType>
     void commit_tree(TreeDBStats& dbStats,
                      Signal& signal,
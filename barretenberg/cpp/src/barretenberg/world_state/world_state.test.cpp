@@ -4,6 +4,7 @@
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/vm2/common/aztec_constants.hpp"
 #include "barretenberg/world_state/fork.hpp"
 #include "barretenberg/world_state/types.hpp"
@@ -540,6 +541,35 @@ TEST_F(WorldStateTest, PublicDataTree)
     EXPECT_EQ(leaf.value().leaf, PublicDataLeafValue(142, 1));
 }
 
+TEST_F(WorldStateTest, GetSiblingPaths)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto tree_id = MerkleTreeId::NULLIFIER_TREE;
+
+    // Unsorted and repeated, across the prefilled leaves, both blocks and the empty part of the tree
+    std::vector<index_t> indices = { 130, 0, 127, 128, 135, 130, 1000 };
+    auto check_paths = [&](const WorldStateRevision& revision) {
+        std::vector<fr_sibling_path> paths = ws.get_sibling_paths(revision, tree_id, indices);
+        ASSERT_EQ(paths.size(), indices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            EXPECT_EQ(paths[i], ws.get_sibling_path(revision, tree_id, indices[i]));
+        }
+    };
+
+    ws.append_leaves<NullifierLeafValue>(tree_id, { NullifierLeafValue(142), NullifierLeafValue(143) });
+    WorldStateStatusFull status;
+    ws.commit(status);
+    std::vector<fr_sibling_path> block_one_paths =
+        ws.get_sibling_paths(WorldStateRevision::committed(), tree_id, indices);
+
+    ws.append_leaves<NullifierLeafValue>(tree_id, { NullifierLeafValue(150), NullifierLeafValue(145) });
+    check_paths(WorldStateRevision::uncommitted());
+    check_paths(WorldStateRevision::committed());
+    check_paths(WorldStateRevision{ .blockNumber = 1 });
+    EXPECT_EQ(ws.get_sibling_paths(WorldStateRevision{ .blockNumber = 1 }, tree_id, indices), block_one_paths);
+    EXPECT_TRUE(ws.get_sibling_paths(WorldStateRevision::uncommitted(), tree_id, {}).empty());
+}
+
 TEST_F(WorldStateTest, CommitsAndRollsBackAllTrees)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -772,6 +802,124 @@ TEST_F(WorldStateTest, SyncEmptyBlock)
     EXPECT_EQ(indices, expected);
 }
 
+TEST_F(WorldStateTest, SyncMultipleBlocks)
+{
+    // build the blocks in one world state and sync them into another
+    std::string builder_dir = data_dir + "/builder";
+    std::string syncer_dir = data_dir + "/syncer";
+    std::filesystem::create_directories(builder_dir);
+    std::filesystem::create_directories(syncer_dir);
+    WorldState builder(
+        thread_pool_size, builder_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldState syncer(
+        thread_pool_size, syncer_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+
+    std::vector<SyncBlockData> blocks;
+    for (uint64_t i = 0; i < 3; i++) {
+        SyncBlockData block{
+            .block_state_ref = {},
+            .block_header_hash = fr(i + 1),
+            .notes = { fr(100 + i), fr(200 + i) },
+            .l1_to_l2_messages = { fr(300 + i) },
+            .nullifiers = { NullifierLeafValue(400 + i) },
+            .public_writes = { PublicDataLeafValue(500, i) },
+        };
+        builder.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, block.notes);
+        builder.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, block.l1_to_l2_messages);
+        builder.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, block.nullifiers);
+        builder.insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, block.public_writes);
+        block.block_state_ref = builder.get_state_reference(WorldStateRevision::uncommitted());
+        builder.update_archive(block.block_state_ref, block.block_header_hash);
+        WorldStateStatusFull status;
+        builder.commit(status);
+        blocks.push_back(block);
+    }
+
+    WorldStateStatusFull status = syncer.sync_blocks(blocks);
+    WorldStateStatusSummary expected{ 3, 0, 1, true };
+    EXPECT_EQ(status.summary, expected);
+    EXPECT_EQ(syncer.get_state_reference(WorldStateRevision::committed()),
+              builder.get_state_reference(WorldStateRevision::committed()));
+
+    for (uint64_t i = 0; i < 3; i++) {
+        assert_leaf_value(syncer, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, i + 1, fr(i + 1));
+        assert_leaf_value(syncer, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 2 * i, fr(100 + i));
+    }
+
+    // a block that does not match its state reference is rejected, and nothing after it is committed
+    std::vector<SyncBlockData> bad_blocks = { blocks.back(), blocks.back() };
+    bad_blocks[0].block_header_hash = fr(4);
+    bad_blocks[1].block_header_hash = fr(5);
+    EXPECT_THROW(syncer.sync_blocks(bad_blocks), std::runtime_error);
+    EXPECT_EQ(syncer.get_state_reference(WorldStateRevision::committed()),
+              builder.get_state_reference(WorldStateRevision::committed()));
+}
+
+TEST_F(WorldStateTest, InsertBlockSideEffects)
+{
+    std::string batched_dir = data_dir + "/batched";
+    std::string single_dir = data_dir + "/single";
+    std::filesystem::create_directories(batched_dir);
+    std::filesystem::create_directories(single_dir);
+    WorldState batched(
+        thread_pool_size, batched_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldState single(
+        thread_pool_size, single_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+
+    std::vector<fr> l1_to_l2_messages = { fr(10), fr(11) };
+    std::vector<TxSideEffects> txs = {
+        { .note_hashes = { fr(20), fr(21), fr(0), fr(0) },
+          .nullifiers = { NullifierLeafValue(150), NullifierLeafValue(140) },
+          .public_data_writes = { PublicDataLeafValue(30, 1) } },
+        { .note_hashes = { fr(22), fr(23), fr(24), fr(0) },
+          .nullifiers = { NullifierLeafValue(145), NullifierLeafValue(146) },
+          .public_data_writes = { PublicDataLeafValue(30, 2), PublicDataLeafValue(31, 1) } },
+    };
+    BlockInsertionResult result = batched.insert_block_side_effects(l1_to_l2_messages, txs);
+    ASSERT_EQ(result.tx_results.size(), txs.size());
+
+    // the same insertions, one at a time
+    single.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, l1_to_l2_messages);
+    fr_sibling_path message_path =
+        single.get_sibling_path(WorldStateRevision::uncommitted(), MerkleTreeId::L1_TO_L2_MESSAGE_TREE, 0);
+    EXPECT_EQ(result.l1_to_l2_message_subtree_path, fr_sibling_path(message_path.begin() + 1, message_path.end()));
+    index_t note_hash_index = 0;
+    for (size_t i = 0; i < txs.size(); i++) {
+        single.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, txs[i].note_hashes);
+        fr_sibling_path path =
+            single.get_sibling_path(WorldStateRevision::uncommitted(), MerkleTreeId::NOTE_HASH_TREE, note_hash_index);
+        auto subtree_depth = static_cast<long>(bb::numeric::get_msb(txs[i].note_hashes.size()));
+        EXPECT_EQ(result.tx_results[i].note_hash_subtree_path,
+                  fr_sibling_path(path.begin() + subtree_depth, path.end()));
+        note_hash_index += txs[i].note_hashes.size();
+
+        auto nullifier_result = single.batch_insert_indexed_leaves<NullifierLeafValue>(
+            MerkleTreeId::NULLIFIER_TREE,
+            txs[i].nullifiers,
+            static_cast<uint32_t>(bb::numeric::get_msb(txs[i].nullifiers.size())));
+        EXPECT_EQ(result.tx_results[i].nullifier_insertion.sorted_leaves, nullifier_result.sorted_leaves);
+        EXPECT_EQ(result.tx_results[i].nullifier_insertion.subtree_path, nullifier_result.subtree_path);
+        EXPECT_EQ(result.tx_results[i].nullifier_insertion.low_leaf_witness_data,
+                  nullifier_result.low_leaf_witness_data);
+
+        auto public_data_result = single.insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE,
+                                                                                    txs[i].public_data_writes);
+        EXPECT_EQ(result.tx_results[i].public_data_insertion.low_leaf_witness_data,
+                  public_data_result.low_leaf_witness_data);
+        EXPECT_EQ(result.tx_results[i].public_data_insertion.insertion_witness_data,
+                  public_data_result.insertion_witness_data);
+    }
+
+    EXPECT_EQ(batched.get_state_reference(WorldStateRevision::uncommitted()),
+              single.get_state_reference(WorldStateRevision::uncommitted()));
+
+    // subtrees must be padded to a power of two
+    std::vector<TxSideEffects> unpadded = { { .note_hashes = { fr(1), fr(2), fr(3) },
+                                              .nullifiers = { NullifierLeafValue(160) },
+                                              .public_data_writes = {} } };
+    EXPECT_THROW(batched.insert_block_side_effects(l1_to_l2_messages, unpadded), std::runtime_error);
+}
+
 TEST_F(WorldStateTest, ForkingAtBlock0SameState)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -43,6 +43,11 @@ export enum WorldStateMessageType {
 
   COPY_STORES,
 
+  INSERT_BLOCK_SIDE_EFFECTS,
+  SYNC_BLOCKS,
+
+  GET_SIBLING_PATHS,
+
   CLOSE = 999,
 }
 
@@ -328,6 +333,11 @@ interface GetBlockNumbersForLeafIndicesResponse {
 interface GetSiblingPathRequest extends WithTreeId, WithLeafIndex, WithWorldStateRevision {}
 type GetSiblingPathResponse = Buffer[];
 
+interface GetSiblingPathsRequest extends WithTreeId, WithWorldStateRevision {
+  leafIndices: bigint[];
+}
+type GetSiblingPathsResponse = Buffer[][];
+
 interface GetStateReferenceRequest extends WithWorldStateRevision {}
 interface GetStateReferenceResponse {
   state: Record<MerkleTreeId, TreeStateReference>;
@@ -400,6 +410,30 @@ interface SyncBlockRequest extends WithCanonicalForkId {
   publicDataWrites: readonly SerializedLeafValue[];
 }
 
+interface SyncBlocksRequest extends WithCanonicalForkId {
+  blocks: readonly SyncBlockRequest[];
+}
+
+interface TxSideEffects {
+  note_hashes: readonly SerializedLeafValue[];
+  nullifiers: readonly SerializedLeafValue[];
+  public_data_writes: readonly SerializedLeafValue[];
+}
+
+interface InsertBlockSideEffectsRequest extends WithForkId {
+  paddedL1ToL2Messages: readonly SerializedLeafValue[];
+  txs: readonly TxSideEffects[];
+}
+
+interface InsertBlockSideEffectsResponse {
+  l1_to_l2_message_subtree_path: Tuple<Buffer, number>;
+  tx_results: ReadonlyArray<{
+    note_hash_subtree_path: Tuple<Buffer, number>;
+    nullifier_insertion: BatchInsertResponse;
+    public_data_insertion: SequentialInsertResponse;
+  }>;
+}
+
 interface CreateForkRequest extends WithCanonicalForkId {
   latest: boolean;
   blockNumber: number;
@@ -469,6 +503,10 @@ export type WorldStateRequest = {
 
   [WorldStateMessageType.COPY_STORES]: CopyStoresRequest;
 
+  [WorldStateMessageType.INSERT_BLOCK_SIDE_EFFECTS]: InsertBlockSideEffectsRequest;
+  [WorldStateMessageType.SYNC_BLOCKS]: SyncBlocksRequest;
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsRequest;
+
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
 
@@ -511,6 +549,10 @@ export type WorldStateResponse = {
 
   [WorldStateMessageType.COPY_STORES]: void;
 
+  [WorldStateMessageType.INSERT_BLOCK_SIDE_EFFECTS]: InsertBlockSideEffectsResponse;
+  [WorldStateMessageType.SYNC_BLOCKS]: WorldStateStatusFull;
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsResponse;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -29,10 +29,12 @@ export const MUTATING_MSG_TYPES = new Set([
   WorldStateMessageType.APPEND_LEAVES,
   WorldStateMessageType.BATCH_INSERT,
   WorldStateMessageType.SEQUENTIAL_INSERT,
+  WorldStateMessageType.INSERT_BLOCK_SIDE_EFFECTS,
   WorldStateMessageType.UPDATE_ARCHIVE,
   WorldStateMessageType.COMMIT,
   WorldStateMessageType.ROLLBACK,
   WorldStateMessageType.SYNC_BLOCK,
+  WorldStateMessageType.SYNC_BLOCKS,
   WorldStateMessageType.CREATE_FORK,
   WorldStateMessageType.DELETE_FORK,
   WorldStateMessageType.FINALISE_BLOCKS,